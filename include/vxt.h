@@ -157,6 +157,23 @@ typedef enum {
 typedef struct vxt_emulator vxt_emulator_t;
 typedef void (*vxt_pause_audio_t)(int);
 
+typedef enum {
+    VXT_STOP_BUDGET,    // Instruction budget exhausted
+    VXT_STOP_QUIT,      // Guest requested shutdown through EMUCTL
+    VXT_STOP_NO_MEDIA,  // No boot media attached
+    VXT_STOP_IDLE       // Guest is waiting for an interrupt or display retrace, see vxt_idle_time
+} vxt_stop_t;
+
+typedef enum {
+    VXT_CORE_INTERPRETER,   // Reference interpreter, decodes and executes one instruction at a time
+    VXT_CORE_BLOCK          // Replays cached straight-line blocks of predecoded instructions, with the same interrupt timing
+} vxt_core_t;
+
+typedef enum {
+    VXT_CPU_8088,   // Intel 8088, plus the 80186 shift and rotate by immediate used by the BIOS
+    VXT_CPU_V20     // NEC V20, runs the 80186 instruction set
+} vxt_cpu_t;
+
 typedef enum {
     VXT_TEXT,
     VXT_CGA,
@@ -180,14 +197,14 @@ typedef struct {
 
     vxt_key_t (*getkey)(void*);
     void (*initialize)(void*,vxt_mode_t,int,int);
-    byte *(*backbuffer)(void*); // Returns a RGB332 buffer with X*Y size
-    void (*textmode)(byte*,byte*,byte,byte,byte);
+    byte *(*backbuffer)(void*); // Returns a RGB332 buffer with X*Y size. Only changed scanlines are written
+    void (*textmode)(byte*,byte*,byte,byte,byte,unsigned); // Last argument has bit n set for each text row n to redraw
 } vxt_video_t;
 
 typedef struct {
     void *userdata;
 
-    int (*filter)(void*,word,int);
+    int (*filter)(void*,word,int); // Asked once per port and direction (0 in, 1 out) when the map is set
     byte (*in)(void*,word);
     void (*out)(void*,word,byte);
 } vxt_port_map_t;
@@ -231,10 +248,19 @@ extern void vxt_set_harddrive(vxt_emulator_t *e, vxt_drive_t *hd);
 extern void vxt_set_port_map(vxt_emulator_t *e, vxt_port_map_t *map);
 extern void vxt_set_serial(vxt_emulator_t *e, int port, vxt_serial_t *com);
 extern void vxt_set_joystick(vxt_emulator_t *e, vxt_joystick_t *stick);
+extern void vxt_raise_irq(vxt_emulator_t *e, int irq); // Raise an IRQ line of the PIC, for port mapped devices. Call from the emulator thread, e.g. in a port map handler
 extern void vxt_set_screen(vxt_emulator_t *e, int enable);
+extern void vxt_set_core(vxt_emulator_t *e, vxt_core_t core);
+extern void vxt_set_cpu(vxt_emulator_t *e, vxt_cpu_t cpu); // VXT_CPU_8088 by default
+extern void vxt_set_frequency(vxt_emulator_t *e, unsigned hz); // Fixed virtual clock ticks per second, or 0 to follow the host clock
+extern void vxt_set_cycle_timing(vxt_emulator_t *e, int enable); // Tick the virtual clock by modelled CPU cycles instead of once per instruction, off by default
+extern void vxt_set_idle(vxt_emulator_t *e, int enable); // Skip virtual time while the guest waits, off by default
+extern unsigned vxt_idle_time(vxt_emulator_t *e); // Microseconds skipped by a run that stopped with VXT_STOP_IDLE
+extern unsigned vxt_run_time(vxt_emulator_t *e); // Microseconds of virtual time covered by the last run, idle time included
 extern void vxt_set_audio_control(vxt_emulator_t *e, vxt_pause_audio_t ac, byte silence);
 extern int vxt_blink(vxt_emulator_t *e);
 extern int vxt_step(vxt_emulator_t *e);
+extern size_t vxt_run(vxt_emulator_t *e, size_t max_instructions, vxt_stop_t *reason);
 extern void vxt_close(vxt_emulator_t *e);
 
 // Expects single channel, 44100Hz, unsigned bytes
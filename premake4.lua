@@ -41,7 +41,7 @@ function create_project(k)
             files { 'src/nfd/nfd_common.c', 'src/nfd/nfd_cocoa.m' }
             includedirs { 'src/nfd' }
         else
-            links { 'SDL2' }
+            links { 'SDL2', 'm' }
         end
     else
         files { 'src/vxt.c' }
@@ -49,6 +49,23 @@ function create_project(k)
     end
 end
 
+function create_bench(lib)
+    kind 'ConsoleApp'
+    language 'C'
+    targetdir ''
+    includedirs { 'include', 'src' }
+    files { 'tools/bench/bench.c' }
+    links { lib }
+    if not os.is('windows') then links { 'm' } end
+    if wall then flags { 'ExtraWarnings'} end
+
+    if os.is('macosx') then
+        platforms { 'native', 'x64' }
+    else
+        platforms { 'native', 'x32', 'x64' }
+    end
+end
+
 function write_version()
     local fp = io.open('src/version.h', 'w')
     fp:write(string.format('#define VERSION_STRING "%s"', version))
@@ -125,7 +142,7 @@ solution 'VirtualXT'
         end
 
     configuration 'gmake'
-        buildoptions { '-fsigned-char -std=gnu99 -Wno-unused-result -Wno-unused-value -fno-strict-aliasing' }
+        buildoptions { '-fsigned-char -std=gnu99 -Wno-unused-result -Wno-unused-value' }
 
     if emscripten then
         buildoptions { '-s USE_SDL=2' }
@@ -140,4 +157,19 @@ solution 'VirtualXT'
     else
         project 'libvxt'
             create_project 'StaticLib'
+
+        project 'vxt-bench'
+            create_bench 'libvxt'
+
+        -- Same library with the threaded interpreter. It needs computed goto, so it is left out of Visual Studio
+        -- solutions.
+        if not (_ACTION and _ACTION:find('^vs')) then
+            project 'libvxt-threaded'
+                create_project 'StaticLib'
+                targetname 'vxt-threaded'
+                defines { 'VXT_THREADED' }
+
+            project 'vxt-bench-threaded'
+                create_bench 'libvxt-threaded'
+        end
     end
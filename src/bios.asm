@@ -313,14 +313,24 @@ next_out:
 	mov	dx, 0x62	; PPI - needed for memory parity checks
 	out	dx, al
 
-; Get initial RTC value
+; Initialise the PIC: edge triggered, single, IRQ 0-7 on INT 8-Fh, 8086 mode. Unmask the timer and keyboard
 
-	push	cs
-	pop	es
-	mov	bx, timetable
-	extended_get_rtc
-	mov	ax, [es:tm_msec]
-	mov	[cs:last_int8_msec], ax
+	mov	al, 0x13
+	out	0x20, al
+	mov	al, 0x08
+	out	0x21, al
+	mov	al, 0x01
+	out	0x21, al
+	mov	al, 0xfc
+	out	0x21, al
+
+; Program PIT channel 0 for the 18.2 Hz timer tick: square wave, count 65536
+
+	mov	al, 0x36
+	out	0x43, al
+	mov	al, 0
+	out	0x40, al
+	out	0x40, al
 
 ; Read boot sector from FDD, and load it into 0:7C00
 
@@ -338,10 +348,9 @@ next_out:
 
 	jmp	0:0x7c00
 
-; ************************* INT 7h handler - keyboard driver (VirtualXT internal)
+; ************************* INT 9h handler - keyboard (PC BIOS standard)
 
-int1d:	; Whenever the user presses a key, INT 7 is called by the emulator.
-	; Scancode is at 0040:this_keystroke and ASCII at 0040:this_keystroke_ascii
+int9:	; IRQ 1. The emulator puts the scancode on port 0x60, and the ASCII code at 0040:this_keystroke_ascii
 
 	push	ds
 	push	es
@@ -358,7 +367,7 @@ int1d:	; Whenever the user presses a key, INT 7 is called by the emulator.
 
 	; Retrieve the keystroke
 
-	mov	al, [es:this_keystroke-bios_data]
+	in	al, 0x60
 	mov	ch, al 				; Save scancode to CH
 
 	and al, 0x7f 			; Remove key up bit
@@ -507,26 +516,6 @@ int1d:	; Whenever the user presses a key, INT 7 is called by the emulator.
 
   	mov	al, ch 			; Restore scancode
 
-	call io_key_available
-
-	pop	bp
-	pop	cx
-	pop	bx
-	pop	ax
-	pop	es
-	pop	ds
-	iret
-
-; ************************* INT 9h handler - keyboard (PC BIOS standard)
-
-int9:
-	push	es
-	push	ax
-	push	bx
-	push	bp
-
-	in	al, 0x60
-
 	cmp	al, 0x80 ; Key up?
 	jae	no_add_buf
 	cmp	al, 0x2A ; LShift?
@@ -544,9 +533,6 @@ int9:
 	cmp	bl, 0x46 ; ScrollLock?
 	je no_add_buf
 
-	mov	bx, 0x40
-	mov	es, bx
-
 	; Tail of the BIOS keyboard buffer goes in BP. This is where we add new keystrokes
 
 	mov	ah, [es:this_keystroke_ascii-bios_data]
@@ -561,121 +547,39 @@ int9:
 
   no_add_buf:
 
-	mov	al, 1
-	out	0x64, al
+	mov	al, 0x20	; End of interrupt
+	out	0x20, al
 
 	pop	bp
+	pop	cx
 	pop	bx
 	pop	ax
 	pop	es
-
+	pop	ds
 	iret
 
-; ************************* INT Ah handler - timer (VirtualXT internal)
-
-inta:
-	; VirtualXT called interrupt 0xA frequently, at a rate dependent on the speed of your computer.
-	; This interrupt handler scales down the call rate and calls INT 8 at 18.2 times per second,
-	; as per a real PC.
+; ************************* INT 8h handler - timer
 
-	; See if there is an ESC waiting from a previous INT 7h. If so, put it in the keyboard buffer
-	; (because by now - 1/18.2 secs on - we know it can't be part of an escape key sequence).
-	; Also handle CGA refresh register. Also release any keys that are still marked as down.
+int8:	; IRQ 0 from PIT channel 0, 18.2 times per second unless a program reprograms the PIT
 
 	push	ax
-	push	bx
-	push	dx
-	push	bp
-	push	es
-
-	push	cx
-	push	di
 	push	ds
-	push	si
-
-	; Increment 32-bit BIOS timer tick counter, once every 18.2 ms
-
-	push	cs
-	pop	es
-	mov	bx, timetable
-	extended_get_rtc
-	
-	mov	ax, [cs:tm_msec]
-	sub	ax, [cs:last_int8_msec]
-
-  make_ctr_positive:
 
-	cmp	ax, 0
-	jge	no_add_1000
-
-	add	ax, 1000
-	jmp	make_ctr_positive
-
-  no_add_1000:
-
-	mov	bx, 0x40
-	mov	es, bx
-
-	mov	dx, 0
-	mov	bx, 1193
-	mul	bx
-
-	mov	bx, [es:timer0_freq-bios_data]
-
-	cmp	bx, 0 ; 0 actually means FFFF
-	jne	no_adjust_10000
-
-	mov	bx, 0xffff
-
-  no_adjust_10000:
-
-	div	bx ; AX now contains number of timer ticks since last int 8 (DX is remainder)
-
-	cmp	ax, 0
-	je	i8_end
-
-	add	word [es:0x6C], ax
-	adc	word [es:0x6E], 0
-
-inta_call_int8:
-
-	push	ax	; Workaround for CPM-86 - INT 1C destroys AX!!
-	int	8
-	pop	ax
+	mov	ax, 0x40
+	mov	ds, ax
 
-	dec	ax
-	cmp	ax, 0
-	jne	inta_call_int8
+	; Increment 32-bit BIOS timer tick counter
 
-	mov	ax, [cs:tm_msec]
-	mov	[cs:last_int8_msec], ax
+	add	word [0x6C], 1
+	adc	word [0x6E], 0
 
-i8_end:	
+	int	0x1c
 
-	; A Hercules graphics adapter flips bit 7 of I/O port 3BA on refresh
-	mov	dx, 0x3BA
-	in 	al, dx
-	xor	al, 0x80
-	out	dx, al
+	mov	al, 0x20	; End of interrupt
+	out	0x20, al
 
-	pop	si
 	pop	ds
-	pop	di
-	pop	cx
-	
-	pop	es
-	pop	bp
-	pop	dx
-	pop	bx
 	pop	ax
-
-	iret
-
-; ************************* INT 8h handler - timer
-
-int8:
-
-	int	0x1c
 	iret
 
 ; ************************* INT 10h handler - video services
@@ -781,6 +685,10 @@ int10:
 	mov	al, 0x8a
 	out	dx, al
 
+	mov	dx, 0x3d9
+	mov	al, 0x30	; CGA colour select: black background, high intensity cyan/magenta/white palette
+	out	dx, al
+
 	mov	bh, 7	
 	call clear_screen
 
@@ -2362,6 +2270,7 @@ int4:
 int5:
 int6:
 int7:
+inta:
 intb:
 intc:
 intd:
@@ -2369,6 +2278,7 @@ inte:
 intf:
 int18:
 int1b:
+int1d:
 
 iret
 
@@ -2577,19 +2487,6 @@ clear_screen:
 
 	ret
 
-; Sets key available flag on I/O port 0x64, outputs key scan code in AL to I/O port 0x60, and calls INT 9
-
-io_key_available:
-
-	push	ax
-	mov	al, 1
-	out	0x64, al
-	pop	ax
-
-	out	0x60, al
-	int	9
-	ret
-
 ; Reaches up into the stack before the end of an interrupt handler, and sets the carry flag
 
 reach_stack_stc:
@@ -2632,7 +2529,7 @@ lpt1addr	dw	0
 lpt2addr	dw	0
 lpt3addr	dw	0
 lpt4addr	dw	0
-equip		dw	0b0000001000100001 		; With COM1
+equip		dw	0b0000001000100011 		; With COM1 and 8087
 ;equip		dw	0b0000000000100001
 		db	0
 memsize		dw	0x280
@@ -2711,8 +2608,8 @@ cursor_visible	db	1
 		db	0
 this_keystroke	db	0
 this_keystroke_ascii		db	0
-timer0_freq	dw	0xffff ; PIT channel 0 (55ms)
-timer2_freq	dw	0      ; PIT channel 2
+		dw	0
+		dw	0
 cga_vmode	db	0
 vmem_offset	dw	0      ; Video RAM offset
 ending:		times (0xff-($-com1addr)) db	0
@@ -2914,10 +2811,6 @@ cga_font 	db	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x81, 0xa5, 0
 			db	0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x30, 0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00
 			db	0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 
-; INT 8 millisecond counter
-
-last_int8_msec	dw	0
-
 ; This is the format of the 36-byte tm structure, returned by the emulator's RTC query call
 
 timetable:
@@ -1,35 +1,35 @@
 unsigned char bios_bin[] = {
-  0xeb, 0x30, 0x0f, 0x10, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x58,
+  0xeb, 0x30, 0xa5, 0x0f, 0x56, 0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x58,
   0x54, 0x20, 0x42, 0x49, 0x4f, 0x53, 0x20, 0x52, 0x65, 0x76, 0x69, 0x73,
   0x69, 0x6f, 0x6e, 0x20, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x00,
   0x01, 0x00, 0xf0, 0x31, 0x34, 0x2f, 0x30, 0x31, 0x2f, 0x32, 0x30, 0x00,
   0xfe, 0x00, 0xbc, 0x00, 0xf0, 0x8e, 0xd4, 0x0e, 0x07, 0x50, 0xfc, 0x31,
   0xc0, 0xbf, 0x18, 0x00, 0xab, 0xbf, 0x31, 0x00, 0xaa, 0x2e, 0x88, 0x16,
-  0x30, 0x0f, 0x52, 0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee, 0xba, 0xb4, 0x03,
+  0xc6, 0x0e, 0x52, 0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee, 0xba, 0xb4, 0x03,
   0xb0, 0x01, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x2d, 0xee, 0xba, 0xb4, 0x03,
   0xb0, 0x06, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x57, 0xee, 0x5a, 0x58, 0x2e,
-  0x80, 0x3e, 0x69, 0x0d, 0x00, 0x74, 0x03, 0xe9, 0xa7, 0x00, 0x2e, 0xc6,
-  0x06, 0x69, 0x0d, 0x01, 0x89, 0xca, 0x89, 0xc1, 0x2e, 0x89, 0x16, 0x57,
-  0x0d, 0x2e, 0x89, 0x0e, 0x59, 0x0d, 0x83, 0xf9, 0x00, 0x74, 0x09, 0x2e,
-  0xc7, 0x06, 0x55, 0x0d, 0x02, 0x00, 0xeb, 0x15, 0x83, 0xfa, 0x00, 0x74,
-  0x09, 0x2e, 0xc7, 0x06, 0x55, 0x0d, 0x02, 0x00, 0xeb, 0x07, 0x2e, 0xc7,
-  0x06, 0x55, 0x0d, 0x01, 0x00, 0x89, 0xc8, 0x2e, 0xc7, 0x06, 0x5d, 0x0d,
-  0x01, 0x00, 0x2e, 0xc7, 0x06, 0x5f, 0x0d, 0x01, 0x00, 0x83, 0xfa, 0x00,
-  0x77, 0x0b, 0x83, 0xf8, 0x3f, 0x77, 0x06, 0x2e, 0xa3, 0x5b, 0x0d, 0xeb,
-  0x10, 0xb9, 0x3f, 0x00, 0xf7, 0xf1, 0x2e, 0xa3, 0x5d, 0x0d, 0x2e, 0xc7,
-  0x06, 0x5b, 0x0d, 0x3f, 0x00, 0xba, 0x00, 0x00, 0x2e, 0xa1, 0x5d, 0x0d,
+  0x80, 0x3e, 0x0a, 0x0d, 0x00, 0x74, 0x03, 0xe9, 0xa7, 0x00, 0x2e, 0xc6,
+  0x06, 0x0a, 0x0d, 0x01, 0x89, 0xca, 0x89, 0xc1, 0x2e, 0x89, 0x16, 0xf8,
+  0x0c, 0x2e, 0x89, 0x0e, 0xfa, 0x0c, 0x83, 0xf9, 0x00, 0x74, 0x09, 0x2e,
+  0xc7, 0x06, 0xf6, 0x0c, 0x02, 0x00, 0xeb, 0x15, 0x83, 0xfa, 0x00, 0x74,
+  0x09, 0x2e, 0xc7, 0x06, 0xf6, 0x0c, 0x02, 0x00, 0xeb, 0x07, 0x2e, 0xc7,
+  0x06, 0xf6, 0x0c, 0x01, 0x00, 0x89, 0xc8, 0x2e, 0xc7, 0x06, 0xfe, 0x0c,
+  0x01, 0x00, 0x2e, 0xc7, 0x06, 0x00, 0x0d, 0x01, 0x00, 0x83, 0xfa, 0x00,
+  0x77, 0x0b, 0x83, 0xf8, 0x3f, 0x77, 0x06, 0x2e, 0xa3, 0xfc, 0x0c, 0xeb,
+  0x10, 0xb9, 0x3f, 0x00, 0xf7, 0xf1, 0x2e, 0xa3, 0xfe, 0x0c, 0x2e, 0xc7,
+  0x06, 0xfc, 0x0c, 0x3f, 0x00, 0xba, 0x00, 0x00, 0x2e, 0xa1, 0xfe, 0x0c,
   0x3d, 0x00, 0x04, 0x77, 0x02, 0xeb, 0x10, 0xb9, 0x00, 0x04, 0xf7, 0xf1,
-  0x2e, 0xa3, 0x5f, 0x0d, 0x2e, 0xc7, 0x06, 0x5d, 0x0d, 0x00, 0x04, 0x2e,
-  0xa1, 0x5f, 0x0d, 0x2e, 0xa2, 0x37, 0x0d, 0x2e, 0xa1, 0x5d, 0x0d, 0x2e,
-  0xa3, 0x35, 0x0d, 0x2e, 0xa1, 0x5b, 0x0d, 0x2e, 0xa2, 0x43, 0x0d, 0x2e,
-  0xff, 0x0e, 0x5d, 0x0d, 0x2e, 0xff, 0x0e, 0x5f, 0x0d, 0xb8, 0x00, 0x00,
+  0x2e, 0xa3, 0x00, 0x0d, 0x2e, 0xc7, 0x06, 0xfe, 0x0c, 0x00, 0x04, 0x2e,
+  0xa1, 0x00, 0x0d, 0x2e, 0xa2, 0xd8, 0x0c, 0x2e, 0xa1, 0xfe, 0x0c, 0x2e,
+  0xa3, 0xd6, 0x0c, 0x2e, 0xa1, 0xfc, 0x0c, 0x2e, 0xa2, 0xe4, 0x0c, 0x2e,
+  0xff, 0x0e, 0xfe, 0x0c, 0x2e, 0xff, 0x0e, 0x00, 0x0d, 0xb8, 0x00, 0x00,
   0x50, 0x9d, 0x0e, 0x0e, 0x1f, 0x17, 0xbc, 0x00, 0xf0, 0xfc, 0x31, 0xc0,
   0x8e, 0xc0, 0x31, 0xff, 0xb9, 0x00, 0x02, 0xf3, 0xab, 0xbf, 0x00, 0x00,
-  0xbe, 0x93, 0x0f, 0x8b, 0x0e, 0x0d, 0x10, 0xf3, 0xa4, 0xb9, 0x35, 0x0d,
+  0xbe, 0x29, 0x0f, 0x8b, 0x0e, 0xa3, 0x0f, 0xf3, 0xa4, 0xb9, 0xd6, 0x0c,
   0x26, 0x89, 0x0e, 0x04, 0x01, 0xb9, 0x00, 0xf0, 0x26, 0x89, 0x0e, 0x06,
   0x01, 0xb8, 0xff, 0xff, 0x8e, 0xc0, 0xbf, 0x00, 0x00, 0xbe, 0x22, 0x01,
   0xb9, 0x10, 0x00, 0xf3, 0xa4, 0xb8, 0x40, 0x00, 0x8e, 0xc0, 0xbf, 0x00,
-  0x00, 0xbe, 0x94, 0x0e, 0xb9, 0x00, 0x01, 0xf3, 0xa4, 0xb8, 0x00, 0xb8,
+  0x00, 0xbe, 0x2a, 0x0e, 0xb9, 0x00, 0x01, 0xf3, 0xa4, 0xb8, 0x00, 0xb8,
   0x8e, 0xc0, 0xbf, 0x00, 0x00, 0xb9, 0xd0, 0x07, 0xb8, 0x00, 0x07, 0xf3,
   0xab, 0xba, 0x61, 0x00, 0xb0, 0x00, 0xee, 0xba, 0x60, 0x00, 0xee, 0xba,
   0x64, 0x00, 0xee, 0xba, 0x00, 0x00, 0xb0, 0xff, 0x42, 0x83, 0xfa, 0x40,
@@ -38,459 +38,450 @@ unsigned char bios_bin[] = {
   0xfa, 0x64, 0x74, 0xe0, 0x81, 0xfa, 0x01, 0x02, 0x74, 0xda, 0xee, 0x81,
   0xfa, 0xff, 0x0f, 0x7c, 0xd3, 0xb0, 0x00, 0xba, 0xda, 0x03, 0xee, 0xba,
   0xba, 0x03, 0xee, 0xba, 0xb8, 0x03, 0xee, 0xba, 0xbc, 0x03, 0xee, 0xba,
-  0x62, 0x00, 0xee, 0x0e, 0x07, 0xbb, 0x11, 0x18, 0x0f, 0x02, 0x26, 0xa1,
-  0x35, 0x18, 0x2e, 0xa3, 0x0f, 0x18, 0xb8, 0x00, 0x00, 0x8e, 0xc0, 0xb8,
-  0x01, 0x02, 0xb6, 0x00, 0x2e, 0x8a, 0x16, 0x30, 0x0f, 0xb9, 0x01, 0x00,
-  0xbb, 0x00, 0x7c, 0xcd, 0x13, 0xea, 0x00, 0x7c, 0x00, 0x00, 0x1e, 0x06,
-  0x50, 0x53, 0x51, 0x55, 0x0e, 0x1f, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0x26,
-  0xa0, 0xa6, 0x00, 0x88, 0xc5, 0x24, 0x7f, 0x88, 0xc3, 0x88, 0xe8, 0x24,
-  0x80, 0x34, 0x80, 0x88, 0xc1, 0x80, 0xfb, 0x2a, 0x74, 0x29, 0x80, 0xfb,
-  0x36, 0x74, 0x24, 0x80, 0xfb, 0x38, 0x74, 0x2f, 0x80, 0xfb, 0x1d, 0x74,
-  0x39, 0x80, 0xfb, 0x3a, 0x74, 0x60, 0x80, 0xfb, 0x45, 0x74, 0x73, 0x80,
-  0xfb, 0x46, 0x75, 0x03, 0xe9, 0x83, 0x00, 0x80, 0xfb, 0x52, 0x74, 0x31,
-  0xe9, 0x99, 0x00, 0x88, 0xc8, 0xc0, 0xe8, 0x07, 0x88, 0xc4, 0x26, 0xa0,
-  0x17, 0x00, 0x24, 0xfe, 0xe9, 0x83, 0x00, 0x88, 0xc8, 0xc0, 0xe8, 0x04,
-  0x88, 0xc4, 0x26, 0xa0, 0x17, 0x00, 0x24, 0xf7, 0xeb, 0x74, 0x88, 0xc8,
-  0xc0, 0xe8, 0x05, 0x88, 0xc4, 0x26, 0xa0, 0x17, 0x00, 0x24, 0xfb, 0xeb,
-  0x65, 0x26, 0x8a, 0x0e, 0x17, 0x00, 0xf6, 0xc1, 0x20, 0x75, 0x61, 0x80,
-  0xf9, 0x00, 0x75, 0x5c, 0x88, 0xc8, 0x24, 0x80, 0x34, 0x80, 0x88, 0xc4,
-  0x88, 0xc8, 0x24, 0x7f, 0xeb, 0x48, 0x80, 0xf9, 0x00, 0x75, 0x49, 0x26,
-  0x8a, 0x0e, 0x17, 0x00, 0x88, 0xc8, 0x24, 0x40, 0x34, 0x40, 0x88, 0xc4,
-  0x88, 0xc8, 0x24, 0xbf, 0xeb, 0x30, 0x80, 0xf9, 0x00, 0x75, 0x31, 0x26,
-  0x8a, 0x0e, 0x17, 0x00, 0x88, 0xc8, 0x24, 0x20, 0x34, 0x20, 0x88, 0xc4,
-  0x88, 0xc8, 0x24, 0xdf, 0xeb, 0x18, 0x80, 0xf9, 0x00, 0x75, 0x19, 0x26,
-  0x8a, 0x0e, 0x17, 0x00, 0x88, 0xc8, 0x24, 0x10, 0x34, 0x10, 0x88, 0xc4,
-  0x88, 0xc8, 0x24, 0xef, 0xeb, 0x00, 0x08, 0xe0, 0x26, 0xa2, 0x17, 0x00,
-  0x88, 0xe8, 0xe8, 0x86, 0x0a, 0x5d, 0x59, 0x5b, 0x58, 0x07, 0x1f, 0xcf,
-  0x06, 0x50, 0x53, 0x55, 0xe4, 0x60, 0x3c, 0x80, 0x73, 0x3f, 0x3c, 0x2a,
-  0x74, 0x3b, 0x3c, 0x36, 0x74, 0x37, 0x3c, 0x38, 0x74, 0x33, 0x3c, 0x1d,
-  0x74, 0x2f, 0x80, 0xfb, 0x3a, 0x74, 0x2a, 0x80, 0xfb, 0x45, 0x74, 0x25,
-  0x80, 0xfb, 0x46, 0x74, 0x20, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0x26, 0x8a,
+  0x62, 0x00, 0xee, 0xb0, 0x13, 0xe6, 0x20, 0xb0, 0x08, 0xe6, 0x21, 0xb0,
+  0x01, 0xe6, 0x21, 0xb0, 0xfc, 0xe6, 0x21, 0xb0, 0x36, 0xe6, 0x43, 0xb0,
+  0x00, 0xe6, 0x40, 0xe6, 0x40, 0xb8, 0x00, 0x00, 0x8e, 0xc0, 0xb8, 0x01,
+  0x02, 0xb6, 0x00, 0x2e, 0x8a, 0x16, 0xc6, 0x0e, 0xb9, 0x01, 0x00, 0xbb,
+  0x00, 0x7c, 0xcd, 0x13, 0xea, 0x00, 0x7c, 0x00, 0x00, 0x1e, 0x06, 0x50,
+  0x53, 0x51, 0x55, 0x0e, 0x1f, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0xe4, 0x60,
+  0x88, 0xc5, 0x24, 0x7f, 0x88, 0xc3, 0x88, 0xe8, 0x24, 0x80, 0x34, 0x80,
+  0x88, 0xc1, 0x80, 0xfb, 0x2a, 0x74, 0x29, 0x80, 0xfb, 0x36, 0x74, 0x24,
+  0x80, 0xfb, 0x38, 0x74, 0x2f, 0x80, 0xfb, 0x1d, 0x74, 0x39, 0x80, 0xfb,
+  0x3a, 0x74, 0x60, 0x80, 0xfb, 0x45, 0x74, 0x73, 0x80, 0xfb, 0x46, 0x75,
+  0x03, 0xe9, 0x83, 0x00, 0x80, 0xfb, 0x52, 0x74, 0x31, 0xe9, 0x99, 0x00,
+  0x88, 0xc8, 0xc0, 0xe8, 0x07, 0x88, 0xc4, 0x26, 0xa0, 0x17, 0x00, 0x24,
+  0xfe, 0xe9, 0x83, 0x00, 0x88, 0xc8, 0xc0, 0xe8, 0x04, 0x88, 0xc4, 0x26,
+  0xa0, 0x17, 0x00, 0x24, 0xf7, 0xeb, 0x74, 0x88, 0xc8, 0xc0, 0xe8, 0x05,
+  0x88, 0xc4, 0x26, 0xa0, 0x17, 0x00, 0x24, 0xfb, 0xeb, 0x65, 0x26, 0x8a,
+  0x0e, 0x17, 0x00, 0xf6, 0xc1, 0x20, 0x75, 0x61, 0x80, 0xf9, 0x00, 0x75,
+  0x5c, 0x88, 0xc8, 0x24, 0x80, 0x34, 0x80, 0x88, 0xc4, 0x88, 0xc8, 0x24,
+  0x7f, 0xeb, 0x48, 0x80, 0xf9, 0x00, 0x75, 0x49, 0x26, 0x8a, 0x0e, 0x17,
+  0x00, 0x88, 0xc8, 0x24, 0x40, 0x34, 0x40, 0x88, 0xc4, 0x88, 0xc8, 0x24,
+  0xbf, 0xeb, 0x30, 0x80, 0xf9, 0x00, 0x75, 0x31, 0x26, 0x8a, 0x0e, 0x17,
+  0x00, 0x88, 0xc8, 0x24, 0x20, 0x34, 0x20, 0x88, 0xc4, 0x88, 0xc8, 0x24,
+  0xdf, 0xeb, 0x18, 0x80, 0xf9, 0x00, 0x75, 0x19, 0x26, 0x8a, 0x0e, 0x17,
+  0x00, 0x88, 0xc8, 0x24, 0x10, 0x34, 0x10, 0x88, 0xc4, 0x88, 0xc8, 0x24,
+  0xef, 0xeb, 0x00, 0x08, 0xe0, 0x26, 0xa2, 0x17, 0x00, 0x88, 0xe8, 0x3c,
+  0x80, 0x73, 0x3a, 0x3c, 0x2a, 0x74, 0x36, 0x3c, 0x36, 0x74, 0x32, 0x3c,
+  0x38, 0x74, 0x2e, 0x3c, 0x1d, 0x74, 0x2a, 0x80, 0xfb, 0x3a, 0x74, 0x25,
+  0x80, 0xfb, 0x45, 0x74, 0x20, 0x80, 0xfb, 0x46, 0x74, 0x1b, 0x26, 0x8a,
   0x26, 0xa7, 0x00, 0x26, 0x8b, 0x2e, 0x1c, 0x00, 0x26, 0x88, 0x66, 0x00,
-  0x26, 0x88, 0x46, 0x01, 0x26, 0x83, 0x06, 0x1c, 0x00, 0x02, 0xe8, 0x5e,
-  0x09, 0xb0, 0x01, 0xe6, 0x64, 0x5d, 0x5b, 0x58, 0x07, 0xcf, 0x50, 0x53,
-  0x52, 0x55, 0x06, 0x51, 0x57, 0x1e, 0x56, 0x0e, 0x07, 0xbb, 0x11, 0x18,
-  0x0f, 0x02, 0x2e, 0xa1, 0x35, 0x18, 0x2e, 0x2b, 0x06, 0x0f, 0x18, 0x83,
-  0xf8, 0x00, 0x7d, 0x05, 0x05, 0xe8, 0x03, 0xeb, 0xf6, 0xbb, 0x40, 0x00,
-  0x8e, 0xc3, 0xba, 0x00, 0x00, 0xbb, 0xa9, 0x04, 0xf7, 0xe3, 0x26, 0x8b,
-  0x1e, 0xa8, 0x00, 0x83, 0xfb, 0x00, 0x75, 0x03, 0xbb, 0xff, 0xff, 0xf7,
-  0xf3, 0x83, 0xf8, 0x00, 0x74, 0x1d, 0x26, 0x01, 0x06, 0x6c, 0x00, 0x26,
-  0x83, 0x16, 0x6e, 0x00, 0x00, 0x50, 0xcd, 0x08, 0x58, 0x48, 0x83, 0xf8,
-  0x00, 0x75, 0xf6, 0x2e, 0xa1, 0x35, 0x18, 0x2e, 0xa3, 0x0f, 0x18, 0xba,
-  0xba, 0x03, 0xec, 0x34, 0x80, 0xee, 0x5e, 0x1f, 0x5f, 0x59, 0x07, 0x5d,
-  0x5a, 0x5b, 0x58, 0xcf, 0xcd, 0x1c, 0xcf, 0x80, 0xfc, 0x00, 0x74, 0x49,
-  0x80, 0xfc, 0x01, 0x75, 0x03, 0xe9, 0xe8, 0x00, 0x80, 0xfc, 0x02, 0x75,
-  0x03, 0xe9, 0xfe, 0x00, 0x80, 0xfc, 0x03, 0x75, 0x03, 0xe9, 0x10, 0x01,
-  0x80, 0xfc, 0x06, 0x75, 0x03, 0xe9, 0x1d, 0x01, 0x80, 0xfc, 0x07, 0x75,
-  0x03, 0xe9, 0x99, 0x01, 0x80, 0xfc, 0x08, 0x75, 0x03, 0xe9, 0x13, 0x02,
-  0x80, 0xfc, 0x09, 0x75, 0x03, 0xe9, 0x8a, 0x02, 0x80, 0xfc, 0x0e, 0x75,
-  0x03, 0xe9, 0x35, 0x02, 0x80, 0xfc, 0x0f, 0x75, 0x03, 0xe9, 0x4e, 0x04,
-  0xcf, 0x52, 0x51, 0x53, 0x06, 0x3c, 0x04, 0x74, 0x3d, 0x3c, 0x05, 0x74,
-  0x39, 0x3c, 0x06, 0x74, 0x35, 0x50, 0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee,
-  0xba, 0xb4, 0x03, 0xb0, 0x01, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x2d, 0xee,
-  0xba, 0xb4, 0x03, 0xb0, 0x06, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x57, 0xee,
-  0xba, 0x40, 0x00, 0x8e, 0xc2, 0x26, 0xc6, 0x06, 0xac, 0x00, 0x00, 0x58,
-  0x3c, 0x07, 0x74, 0x3d, 0x3c, 0x02, 0x74, 0x39, 0xeb, 0x39, 0xba, 0x40,
-  0x00, 0x8e, 0xc2, 0x26, 0xa2, 0x49, 0x00, 0x26, 0xc6, 0x06, 0xac, 0x00,
-  0x01, 0xba, 0xb4, 0x03, 0xb0, 0x01, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x28,
-  0xee, 0xba, 0xb4, 0x03, 0xb0, 0x06, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x64,
-  0xee, 0xba, 0xb8, 0x03, 0xb0, 0x8a, 0xee, 0xb7, 0x07, 0xe8, 0xb7, 0x08,
-  0xb8, 0x30, 0x00, 0xeb, 0x26, 0xb0, 0x03, 0xbb, 0x40, 0x00, 0x8e, 0xc3,
-  0x26, 0xa2, 0x49, 0x00, 0xb7, 0x07, 0xe8, 0xa2, 0x08, 0x26, 0x80, 0x3e,
-  0x49, 0x00, 0x06, 0x74, 0x04, 0xb0, 0x30, 0xeb, 0x02, 0xb0, 0x3f, 0x50,
-  0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee, 0x58, 0x07, 0x5b, 0x59, 0x5a, 0xcf,
-  0x1e, 0x50, 0x51, 0xb8, 0x40, 0x00, 0x8e, 0xd8, 0xc6, 0x06, 0xa1, 0x00,
-  0x01, 0x80, 0xe5, 0x60, 0x80, 0xfd, 0x20, 0x75, 0x05, 0xc6, 0x06, 0xa1,
-  0x00, 0x00, 0x59, 0x58, 0x1f, 0xcf, 0x1e, 0x50, 0xb8, 0x40, 0x00, 0x8e,
-  0xd8, 0x88, 0x36, 0x51, 0x00, 0x88, 0x36, 0x9e, 0x00, 0x88, 0x16, 0x50,
-  0x00, 0x88, 0x16, 0x9d, 0x00, 0x58, 0x1f, 0xcf, 0x06, 0xb9, 0x40, 0x00,
-  0x8e, 0xc1, 0xb9, 0x07, 0x06, 0x26, 0x8a, 0x16, 0x50, 0x00, 0x26, 0x8a,
-  0x36, 0x51, 0x00, 0x07, 0xcf, 0x3c, 0x00, 0x75, 0x13, 0x83, 0xf9, 0x00,
-  0x75, 0x0e, 0x80, 0xfa, 0x4f, 0x72, 0x09, 0x80, 0xfe, 0x18, 0x72, 0x04,
-  0xe8, 0x24, 0x08, 0xcf, 0x53, 0x50, 0x1e, 0x06, 0x51, 0x52, 0x56, 0x57,
-  0x53, 0xbb, 0x00, 0xb8, 0x8e, 0xc3, 0x8e, 0xdb, 0x5b, 0x88, 0xc3, 0x80,
-  0xfb, 0x00, 0x74, 0x4c, 0x53, 0x52, 0xb8, 0x00, 0x00, 0x88, 0xe8, 0xbb,
-  0x50, 0x00, 0xf7, 0xe3, 0x00, 0xc8, 0x80, 0xd4, 0x00, 0xbb, 0x02, 0x00,
-  0xf7, 0xe3, 0x5a, 0x5b, 0x89, 0xc7, 0x89, 0xc6, 0x81, 0xc6, 0xa0, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0xd0, 0x80, 0xd4, 0x00, 0x40, 0x28, 0xc8, 0x80,
-  0xdc, 0x00, 0x38, 0xf5, 0x73, 0x0b, 0x51, 0x89, 0xc1, 0xfc, 0xf3, 0xa5,
-  0x59, 0xfe, 0xc5, 0xeb, 0xc3, 0x51, 0x89, 0xc1, 0x88, 0xfc, 0xb0, 0x00,
-  0xfc, 0xf3, 0xab, 0x59, 0xfe, 0xcb, 0xeb, 0xaf, 0x5f, 0x5e, 0x5a, 0x59,
-  0x07, 0x1f, 0x58, 0x5b, 0xcf, 0x3c, 0x00, 0x75, 0x13, 0x83, 0xf9, 0x00,
-  0x75, 0x0e, 0x80, 0xfa, 0x4f, 0x75, 0x09, 0x80, 0xfe, 0x18, 0x7c, 0x04,
-  0xe8, 0xa0, 0x07, 0xcf, 0x50, 0x53, 0x1e, 0x06, 0x51, 0x52, 0x56, 0x57,
-  0x53, 0xbb, 0x00, 0xb8, 0x8e, 0xc3, 0x8e, 0xdb, 0x5b, 0x88, 0xc3, 0x80,
-  0xfb, 0x00, 0x74, 0x4a, 0x53, 0x52, 0xb8, 0x00, 0x00, 0x88, 0xf0, 0xbb,
-  0x50, 0x00, 0xf7, 0xe3, 0x00, 0xc8, 0x80, 0xd4, 0x00, 0xbb, 0x02, 0x00,
-  0xf7, 0xe3, 0x5a, 0x5b, 0x89, 0xc7, 0x89, 0xc6, 0x81, 0xee, 0xa0, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0xd0, 0x80, 0xd4, 0x00, 0x40, 0x28, 0xc8, 0x80,
-  0xdc, 0x00, 0x38, 0xf5, 0x73, 0x0a, 0x51, 0x89, 0xc1, 0xf3, 0xa5, 0x59,
-  0xfe, 0xce, 0xeb, 0xc4, 0x51, 0x89, 0xc1, 0x88, 0xfc, 0xb0, 0x00, 0xf3,
-  0xab, 0x59, 0xfe, 0xcb, 0xeb, 0xb1, 0x5f, 0x5e, 0x5a, 0x59, 0x07, 0x1f,
-  0x5b, 0x58, 0xcf, 0x1e, 0x06, 0x53, 0x52, 0xbb, 0x40, 0x00, 0x8e, 0xc3,
-  0xbb, 0x00, 0xb8, 0x8e, 0xdb, 0xbb, 0xa0, 0x00, 0xb8, 0x00, 0x00, 0x26,
-  0xa0, 0x51, 0x00, 0xf7, 0xe3, 0xbb, 0x00, 0x00, 0x26, 0x8a, 0x1e, 0x50,
-  0x00, 0x01, 0xd8, 0x01, 0xd8, 0x89, 0xc3, 0xb4, 0x07, 0x8a, 0x07, 0x5a,
-  0x5b, 0x07, 0x1f, 0xcf, 0xcf, 0x1e, 0x06, 0x51, 0x52, 0x50, 0x55, 0x53,
-  0x50, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0x88, 0xc1, 0xb5, 0x07, 0xbb, 0x00,
-  0xb8, 0x8e, 0xdb, 0x3c, 0x20, 0x7c, 0x2f, 0x26, 0x80, 0x3e, 0x49, 0x00,
-  0x04, 0x74, 0x24, 0x26, 0x80, 0x3e, 0x49, 0x00, 0x05, 0x74, 0x1c, 0xbb,
-  0xa0, 0x00, 0xb8, 0x00, 0x00, 0x26, 0xa0, 0x51, 0x00, 0xf7, 0xe3, 0xbb,
-  0x00, 0x00, 0x26, 0x8a, 0x1e, 0x50, 0x00, 0xd1, 0xe3, 0x01, 0xc3, 0x89,
-  0x0f, 0xeb, 0x03, 0xe8, 0xbe, 0x00, 0x58, 0x50, 0xeb, 0x39, 0x1e, 0x06,
-  0x51, 0x52, 0x50, 0x55, 0x53, 0x50, 0x88, 0xc2, 0x88, 0xde, 0xbb, 0x40,
-  0x00, 0x8e, 0xc3, 0xbb, 0x00, 0xb8, 0x8e, 0xdb, 0xbb, 0xa0, 0x00, 0xb8,
-  0x00, 0x00, 0x26, 0xa0, 0x51, 0x00, 0xf7, 0xe3, 0xbb, 0x00, 0x00, 0x26,
-  0x8a, 0x1e, 0x50, 0x00, 0xd1, 0xe3, 0x01, 0xc3, 0x89, 0x17, 0x83, 0xc3,
-  0x02, 0x49, 0x83, 0xf9, 0x00, 0x75, 0xf5, 0x58, 0x06, 0x1f, 0x3c, 0x08,
-  0x75, 0x1b, 0xfe, 0x0e, 0x50, 0x00, 0xfe, 0x0e, 0x9d, 0x00, 0x80, 0x3e,
-  0x50, 0x00, 0x00, 0x7f, 0x63, 0xc6, 0x06, 0x50, 0x00, 0x00, 0xc6, 0x06,
-  0x9d, 0x00, 0x00, 0xeb, 0x57, 0x3c, 0x0a, 0x74, 0x21, 0x3c, 0x0d, 0x75,
-  0x0c, 0xc6, 0x06, 0x50, 0x00, 0x00, 0xc6, 0x06, 0x9d, 0x00, 0x00, 0xeb,
-  0x43, 0xfe, 0x06, 0x50, 0x00, 0xfe, 0x06, 0x9d, 0x00, 0x80, 0x3e, 0x50,
-  0x00, 0x50, 0x7d, 0x02, 0xeb, 0x32, 0xc6, 0x06, 0x50, 0x00, 0x00, 0xc6,
-  0x06, 0x9d, 0x00, 0x00, 0xfe, 0x06, 0x51, 0x00, 0xfe, 0x06, 0x9e, 0x00,
-  0x80, 0x3e, 0x51, 0x00, 0x19, 0x72, 0x19, 0xc6, 0x06, 0x51, 0x00, 0x18,
-  0xc6, 0x06, 0x9e, 0x00, 0x18, 0xb7, 0x07, 0xb0, 0x01, 0xb9, 0x00, 0x00,
-  0xba, 0x4f, 0x18, 0x9c, 0x0e, 0xe8, 0xc9, 0xfd, 0x5b, 0x5d, 0x58, 0x5a,
-  0x59, 0x07, 0x1f, 0xcf, 0x50, 0x53, 0x51, 0x1e, 0x06, 0x57, 0x55, 0x80,
-  0xfc, 0x01, 0x75, 0x04, 0xb7, 0x55, 0xeb, 0x0b, 0x80, 0xfc, 0x02, 0x75,
-  0x04, 0xb7, 0xaa, 0xeb, 0x02, 0xb7, 0xff, 0xa8, 0x80, 0x75, 0x11, 0xb4,
-  0x00, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0x05, 0x0f, 0x10, 0x89, 0xc5,
-  0x8c, 0xc9, 0xeb, 0x1c, 0x24, 0x7f, 0xb4, 0x00, 0xd1, 0xe0, 0xd1, 0xe0,
-  0xd1, 0xe0, 0x89, 0xc5, 0xb8, 0x00, 0x00, 0x8e, 0xd8, 0x3e, 0xa1, 0x7c,
-  0x00, 0x01, 0xc5, 0x3e, 0x8b, 0x0e, 0x7e, 0x00, 0xb8, 0x40, 0x00, 0x8e,
-  0xd8, 0xb0, 0x50, 0x3e, 0xf6, 0x26, 0x51, 0x00, 0xd1, 0xe0, 0xd1, 0xe0,
-  0x3e, 0x02, 0x06, 0x50, 0x00, 0x80, 0xd4, 0x00, 0x3e, 0x02, 0x06, 0x50,
-  0x00, 0x80, 0xd4, 0x00, 0x89, 0xc7, 0x8e, 0xd9, 0xb8, 0x00, 0xb8, 0x8e,
-  0xc0, 0x57, 0x3e, 0x8a, 0x5e, 0x00, 0xe8, 0x59, 0x00, 0xab, 0x83, 0xc7,
-  0x4e, 0x3e, 0x8a, 0x5e, 0x02, 0xe8, 0x4e, 0x00, 0xab, 0x83, 0xc7, 0x4e,
-  0x3e, 0x8a, 0x5e, 0x04, 0xe8, 0x43, 0x00, 0xab, 0x83, 0xc7, 0x4e, 0x3e,
-  0x8a, 0x5e, 0x06, 0xe8, 0x38, 0x00, 0xab, 0xb8, 0x00, 0xba, 0x8e, 0xc0,
-  0x5f, 0x3e, 0x8a, 0x5e, 0x01, 0xe8, 0x2a, 0x00, 0xab, 0x83, 0xc7, 0x4e,
-  0x3e, 0x8a, 0x5e, 0x03, 0xe8, 0x1f, 0x00, 0xab, 0x83, 0xc7, 0x4e, 0x3e,
-  0x8a, 0x5e, 0x05, 0xe8, 0x14, 0x00, 0xab, 0x83, 0xc7, 0x4e, 0x3e, 0x8a,
-  0x5e, 0x07, 0xe8, 0x09, 0x00, 0xab, 0x5d, 0x5f, 0x07, 0x1f, 0x59, 0x5b,
-  0x58, 0xc3, 0xb8, 0x00, 0x00, 0xf6, 0xc3, 0x80, 0x74, 0x02, 0x0c, 0xc0,
-  0xf6, 0xc3, 0x40, 0x74, 0x02, 0x0c, 0x30, 0xf6, 0xc3, 0x20, 0x74, 0x02,
-  0x0c, 0x0c, 0xf6, 0xc3, 0x10, 0x74, 0x02, 0x0c, 0x03, 0xf6, 0xc3, 0x08,
-  0x74, 0x03, 0x80, 0xcc, 0xc0, 0xf6, 0xc3, 0x04, 0x74, 0x03, 0x80, 0xcc,
-  0x30, 0xf6, 0xc3, 0x02, 0x74, 0x03, 0x80, 0xcc, 0x0c, 0xf6, 0xc3, 0x01,
-  0x74, 0x03, 0x80, 0xcc, 0x03, 0x20, 0xf8, 0x20, 0xfc, 0xc3, 0x06, 0xb8,
-  0x40, 0x00, 0x8e, 0xc0, 0xb4, 0x50, 0x26, 0xa0, 0x49, 0x00, 0xb7, 0x00,
-  0x07, 0xcf, 0x2e, 0xa1, 0xa4, 0x0e, 0xcf, 0xb8, 0x80, 0x02, 0xcf, 0x80,
-  0xfc, 0x00, 0x74, 0x62, 0x80, 0xfc, 0x01, 0x74, 0x60, 0x80, 0xfa, 0x80,
-  0x75, 0x0d, 0x2e, 0x83, 0x3e, 0x55, 0x0d, 0x02, 0x7d, 0x05, 0xb4, 0x0f,
-  0xe9, 0xf3, 0x04, 0x80, 0xfc, 0x02, 0x74, 0x54, 0x80, 0xfc, 0x03, 0x75,
-  0x03, 0xe9, 0xb5, 0x00, 0x80, 0xfc, 0x04, 0x75, 0x03, 0xe9, 0x10, 0x01,
-  0x80, 0xfc, 0x05, 0x75, 0x03, 0xe9, 0x7f, 0x01, 0x80, 0xfc, 0x08, 0x75,
-  0x03, 0xe9, 0x05, 0x01, 0x80, 0xfc, 0x0c, 0x75, 0x03, 0xe9, 0x55, 0x01,
-  0x80, 0xfc, 0x10, 0x75, 0x03, 0xe9, 0x52, 0x01, 0x80, 0xfc, 0x15, 0x75,
-  0x03, 0xe9, 0x64, 0x01, 0x80, 0xfc, 0x16, 0x75, 0x03, 0xe9, 0x84, 0x01,
-  0xb4, 0x01, 0xe9, 0xa9, 0x04, 0xcf, 0xe9, 0xae, 0x04, 0x2e, 0x8a, 0x26,
-  0xd5, 0x0e, 0x74, 0x02, 0xf9, 0xcf, 0xf8, 0xcf, 0x52, 0x80, 0xfa, 0x00,
-  0x74, 0x0b, 0x80, 0xfa, 0x80, 0x74, 0x15, 0x5a, 0xb4, 0x01, 0xe9, 0x89,
-  0x04, 0x56, 0x55, 0x2e, 0x3a, 0x0e, 0x2e, 0x0d, 0x77, 0x41, 0x5d, 0x5e,
-  0xb2, 0x01, 0xeb, 0x02, 0xb2, 0x00, 0x56, 0x55, 0xe8, 0xbf, 0x03, 0xb4,
-  0x00, 0xc1, 0xe0, 0x09, 0x0f, 0x03, 0xc1, 0xe8, 0x09, 0xb4, 0x02, 0x3c,
-  0x00, 0x74, 0x24, 0x83, 0xfa, 0x01, 0x75, 0x1a, 0x83, 0xf9, 0x01, 0x75,
-  0x15, 0x50, 0x26, 0x8a, 0x47, 0x18, 0x3c, 0x09, 0x74, 0x07, 0x3c, 0x12,
-  0x74, 0x03, 0x58, 0xeb, 0x05, 0x2e, 0xa2, 0x2e, 0x0d, 0x58, 0xf8, 0xb4,
-  0x00, 0xeb, 0x03, 0xf9, 0xb4, 0x04, 0x5d, 0x5e, 0x5a, 0x2e, 0x88, 0x26,
-  0xd5, 0x0e, 0xe9, 0x43, 0x04, 0x52, 0x80, 0xfa, 0x00, 0x74, 0x0b, 0x80,
-  0xfa, 0x80, 0x74, 0x0a, 0x5a, 0xb4, 0x01, 0xe9, 0x20, 0x04, 0xb2, 0x01,
-  0xeb, 0x02, 0xb2, 0x00, 0x56, 0x55, 0x51, 0x57, 0xe8, 0x5f, 0x03, 0x80,
-  0xfa, 0x00, 0x75, 0x1b, 0x89, 0xe9, 0x89, 0xf7, 0xb4, 0x00, 0x01, 0xc1,
-  0x83, 0xd7, 0x00, 0x2e, 0x3b, 0x3e, 0x57, 0x0d, 0x77, 0x1e, 0x72, 0x07,
-  0x2e, 0x3b, 0x0e, 0x59, 0x0d, 0x77, 0x15, 0xb4, 0x00, 0xc1, 0xe0, 0x09,
-  0x0f, 0x04, 0xc1, 0xe8, 0x09, 0xb4, 0x03, 0x3c, 0x00, 0x74, 0x05, 0xf8,
-  0xb4, 0x00, 0xeb, 0x03, 0xf9, 0xb4, 0x04, 0x5f, 0x59, 0x5d, 0x5e, 0x5a,
-  0x2e, 0x88, 0x26, 0xd5, 0x0e, 0xe9, 0xe0, 0x03, 0xb4, 0x00, 0xe9, 0xd2,
-  0x03, 0x80, 0xfa, 0x00, 0x74, 0x0f, 0x80, 0xfa, 0x80, 0x74, 0x28, 0xb4,
-  0x01, 0x2e, 0x88, 0x26, 0xd5, 0x0e, 0xe9, 0xb5, 0x03, 0x0e, 0x07, 0xbf,
-  0x2a, 0x0d, 0xb8, 0x00, 0x00, 0xbb, 0x04, 0x00, 0xb5, 0x4f, 0x2e, 0x8a,
-  0x0e, 0x2e, 0x0d, 0xba, 0x01, 0x01, 0x2e, 0xc6, 0x06, 0xd5, 0x0e, 0x00,
-  0xe9, 0xa0, 0x03, 0xb8, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xb2, 0x01, 0x2e,
-  0x8a, 0x36, 0x5f, 0x0d, 0x2e, 0x8b, 0x0e, 0x5d, 0x0d, 0xd0, 0xcd, 0xd0,
-  0xcd, 0x2e, 0x02, 0x2e, 0x5b, 0x0d, 0x86, 0xe9, 0x2e, 0xc6, 0x06, 0xd5,
-  0x0e, 0x00, 0xe9, 0x7a, 0x03, 0xb4, 0x00, 0xe9, 0x75, 0x03, 0x2e, 0x80,
-  0x3e, 0x55, 0x0d, 0x02, 0x75, 0x0a, 0x80, 0xfa, 0x80, 0x75, 0x05, 0xb4,
-  0x00, 0xe9, 0x63, 0x03, 0xe9, 0x57, 0x03, 0xb4, 0x00, 0xe9, 0x5b, 0x03,
-  0x80, 0xfa, 0x00, 0x74, 0x0f, 0x80, 0xfa, 0x80, 0x74, 0x0f, 0xb4, 0x0f,
-  0x2e, 0x88, 0x26, 0xd5, 0x0e, 0xe9, 0x3e, 0x03, 0xb4, 0x01, 0xe9, 0x42,
-  0x03, 0xb4, 0x03, 0x2e, 0x8b, 0x0e, 0x57, 0x0d, 0x2e, 0x8b, 0x16, 0x59,
-  0x0d, 0xe9, 0x33, 0x03, 0xb4, 0x00, 0xe9, 0x2e, 0x03, 0x0f, 0x05, 0xe9,
-  0x20, 0x03, 0x80, 0xfc, 0x84, 0x74, 0x02, 0xeb, 0x37, 0x50, 0xb0, 0x01,
-  0xb4, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x58, 0x74, 0x2b, 0x83, 0xfa, 0x00,
-  0x74, 0x07, 0x83, 0xfa, 0x01, 0x74, 0x11, 0xeb, 0x1f, 0x53, 0x51, 0xb0,
-  0x01, 0xb4, 0x01, 0x0f, 0x00, 0xc0, 0xe0, 0x04, 0x59, 0x5b, 0xeb, 0x0d,
-  0xb0, 0x01, 0xb4, 0x01, 0x0f, 0x00, 0x89, 0xd8, 0x89, 0xcb, 0xba, 0x00,
-  0x00, 0xe9, 0xeb, 0x02, 0xb4, 0x86, 0xe9, 0xdd, 0x02, 0x80, 0xfc, 0x00,
-  0x74, 0x10, 0x80, 0xfc, 0x01, 0x74, 0x39, 0x80, 0xfc, 0x02, 0x74, 0x58,
-  0x80, 0xfc, 0x12, 0x74, 0x61, 0xcf, 0x06, 0x53, 0x51, 0x52, 0xbb, 0x40,
-  0x00, 0x8e, 0xc3, 0xfa, 0x26, 0x8b, 0x0e, 0x1c, 0x00, 0x26, 0x8b, 0x1e,
-  0x1a, 0x00, 0x26, 0x8b, 0x17, 0xfb, 0x39, 0xd9, 0x74, 0xed, 0x26, 0x83,
-  0x06, 0x1a, 0x00, 0x02, 0xe8, 0xc0, 0x01, 0x88, 0xf4, 0x88, 0xd0, 0x5a,
-  0x59, 0x5b, 0x07, 0xcf, 0x06, 0x53, 0x51, 0x52, 0xbb, 0x40, 0x00, 0x8e,
-  0xc3, 0x26, 0x8b, 0x0e, 0x1c, 0x00, 0x26, 0x8b, 0x1e, 0x1a, 0x00, 0x26,
-  0x8b, 0x17, 0xfb, 0x39, 0xd9, 0x88, 0xf4, 0x88, 0xd0, 0x5a, 0x59, 0x5b,
-  0x07, 0xca, 0x02, 0x00, 0x06, 0x53, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0x26,
-  0xa0, 0x17, 0x00, 0x5b, 0x07, 0xcf, 0x06, 0x53, 0xbb, 0x40, 0x00, 0x8e,
-  0xc3, 0x26, 0xa0, 0x17, 0x00, 0x88, 0xc4, 0x5b, 0x07, 0xcf, 0x80, 0xfc,
-  0x01, 0x74, 0x03, 0xe9, 0x50, 0x02, 0xb4, 0x01, 0xe9, 0x4b, 0x02, 0xe9,
-  0xe7, 0xf5, 0x80, 0xfc, 0x00, 0x74, 0x16, 0x80, 0xfc, 0x02, 0x74, 0x70,
-  0x80, 0xfc, 0x04, 0x75, 0x03, 0xe9, 0xa4, 0x00, 0x80, 0xfc, 0x0f, 0x75,
-  0x03, 0xe9, 0xd6, 0x00, 0xcf, 0x50, 0x53, 0x1e, 0x06, 0x0e, 0x0e, 0x1f,
-  0x07, 0xbb, 0x11, 0x18, 0x0f, 0x02, 0xb8, 0xb6, 0x00, 0xf7, 0x26, 0x35,
-  0x18, 0xbb, 0x10, 0x27, 0xf7, 0xf3, 0xa3, 0x35, 0x18, 0xb8, 0xb6, 0x00,
-  0xf7, 0x26, 0x11, 0x18, 0xbb, 0x0a, 0x00, 0xba, 0x00, 0x00, 0xf7, 0xf3,
-  0xa3, 0x11, 0x18, 0xb8, 0x44, 0x04, 0xf7, 0x26, 0x15, 0x18, 0xa3, 0x15,
-  0x18, 0xb8, 0xf0, 0xff, 0xf7, 0x26, 0x19, 0x18, 0x03, 0x06, 0x35, 0x18,
-  0x83, 0xd2, 0x00, 0x03, 0x06, 0x11, 0x18, 0x83, 0xd2, 0x00, 0x03, 0x06,
-  0x15, 0x18, 0x83, 0xd2, 0x00, 0x52, 0x50, 0x5a, 0x59, 0x07, 0x1f, 0x5b,
-  0x58, 0xb0, 0x00, 0xcf, 0x1e, 0x06, 0x50, 0x53, 0x0e, 0x0e, 0x1f, 0x07,
-  0xbb, 0x11, 0x18, 0x0f, 0x02, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0x19, 0x18,
-  0xe8, 0xa5, 0x00, 0x88, 0xc7, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0x15, 0x18,
-  0xe8, 0x99, 0x00, 0x88, 0xc3, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0x11, 0x18,
-  0xe8, 0x8d, 0x00, 0x88, 0xc6, 0xb2, 0x00, 0x89, 0xd9, 0x5b, 0x58, 0x07,
-  0x1f, 0xe9, 0x9b, 0x01, 0x1e, 0x06, 0x53, 0x50, 0x0e, 0x0e, 0x1f, 0x07,
-  0xbb, 0x11, 0x18, 0x0f, 0x02, 0xb8, 0x00, 0x19, 0x8b, 0x0e, 0x25, 0x18,
-  0xe8, 0x69, 0x00, 0x89, 0xc1, 0x51, 0xb8, 0x01, 0x00, 0x8b, 0x0e, 0x21,
-  0x18, 0xe8, 0x5c, 0x00, 0x88, 0xc6, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0x1d,
-  0x18, 0xe8, 0x50, 0x00, 0x88, 0xc2, 0x59, 0x58, 0x5b, 0x07, 0x1f, 0xe9,
-  0x61, 0x01, 0xe9, 0x5e, 0x01, 0xcf, 0xdf, 0x02, 0x25, 0x02, 0x12, 0x1b,
-  0xff, 0x54, 0xf6, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xfe,
-  0x41, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0x88, 0x46, 0x01, 0x26, 0x83, 0x06, 0x1c, 0x00, 0x02, 0xe8, 0x0b,
+  0x09, 0xb0, 0x20, 0xe6, 0x20, 0x5d, 0x59, 0x5b, 0x58, 0x07, 0x1f, 0xcf,
+  0x50, 0x1e, 0xb8, 0x40, 0x00, 0x8e, 0xd8, 0x83, 0x06, 0x6c, 0x00, 0x01,
+  0x83, 0x16, 0x6e, 0x00, 0x00, 0xcd, 0x1c, 0xb0, 0x20, 0xe6, 0x20, 0x1f,
+  0x58, 0xcf, 0x80, 0xfc, 0x00, 0x74, 0x49, 0x80, 0xfc, 0x01, 0x75, 0x03,
+  0xe9, 0xee, 0x00, 0x80, 0xfc, 0x02, 0x75, 0x03, 0xe9, 0x04, 0x01, 0x80,
+  0xfc, 0x03, 0x75, 0x03, 0xe9, 0x16, 0x01, 0x80, 0xfc, 0x06, 0x75, 0x03,
+  0xe9, 0x23, 0x01, 0x80, 0xfc, 0x07, 0x75, 0x03, 0xe9, 0x9f, 0x01, 0x80,
+  0xfc, 0x08, 0x75, 0x03, 0xe9, 0x19, 0x02, 0x80, 0xfc, 0x09, 0x75, 0x03,
+  0xe9, 0x90, 0x02, 0x80, 0xfc, 0x0e, 0x75, 0x03, 0xe9, 0x3b, 0x02, 0x80,
+  0xfc, 0x0f, 0x75, 0x03, 0xe9, 0x54, 0x04, 0xcf, 0x52, 0x51, 0x53, 0x06,
+  0x3c, 0x04, 0x74, 0x3d, 0x3c, 0x05, 0x74, 0x39, 0x3c, 0x06, 0x74, 0x35,
+  0x50, 0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee, 0xba, 0xb4, 0x03, 0xb0, 0x01,
+  0xee, 0xba, 0xb5, 0x03, 0xb0, 0x2d, 0xee, 0xba, 0xb4, 0x03, 0xb0, 0x06,
+  0xee, 0xba, 0xb5, 0x03, 0xb0, 0x57, 0xee, 0xba, 0x40, 0x00, 0x8e, 0xc2,
+  0x26, 0xc6, 0x06, 0xac, 0x00, 0x00, 0x58, 0x3c, 0x07, 0x74, 0x43, 0x3c,
+  0x02, 0x74, 0x3f, 0xeb, 0x3f, 0xba, 0x40, 0x00, 0x8e, 0xc2, 0x26, 0xa2,
+  0x49, 0x00, 0x26, 0xc6, 0x06, 0xac, 0x00, 0x01, 0xba, 0xb4, 0x03, 0xb0,
+  0x01, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x28, 0xee, 0xba, 0xb4, 0x03, 0xb0,
+  0x06, 0xee, 0xba, 0xb5, 0x03, 0xb0, 0x64, 0xee, 0xba, 0xb8, 0x03, 0xb0,
+  0x8a, 0xee, 0xba, 0xd9, 0x03, 0xb0, 0x30, 0xee, 0xb7, 0x07, 0xe8, 0xb7,
+  0x08, 0xb8, 0x30, 0x00, 0xeb, 0x26, 0xb0, 0x03, 0xbb, 0x40, 0x00, 0x8e,
+  0xc3, 0x26, 0xa2, 0x49, 0x00, 0xb7, 0x07, 0xe8, 0xa2, 0x08, 0x26, 0x80,
+  0x3e, 0x49, 0x00, 0x06, 0x74, 0x04, 0xb0, 0x30, 0xeb, 0x02, 0xb0, 0x3f,
+  0x50, 0xba, 0xb8, 0x03, 0xb0, 0x00, 0xee, 0x58, 0x07, 0x5b, 0x59, 0x5a,
+  0xcf, 0x1e, 0x50, 0x51, 0xb8, 0x40, 0x00, 0x8e, 0xd8, 0xc6, 0x06, 0xa1,
+  0x00, 0x01, 0x80, 0xe5, 0x60, 0x80, 0xfd, 0x20, 0x75, 0x05, 0xc6, 0x06,
+  0xa1, 0x00, 0x00, 0x59, 0x58, 0x1f, 0xcf, 0x1e, 0x50, 0xb8, 0x40, 0x00,
+  0x8e, 0xd8, 0x88, 0x36, 0x51, 0x00, 0x88, 0x36, 0x9e, 0x00, 0x88, 0x16,
+  0x50, 0x00, 0x88, 0x16, 0x9d, 0x00, 0x58, 0x1f, 0xcf, 0x06, 0xb9, 0x40,
+  0x00, 0x8e, 0xc1, 0xb9, 0x07, 0x06, 0x26, 0x8a, 0x16, 0x50, 0x00, 0x26,
+  0x8a, 0x36, 0x51, 0x00, 0x07, 0xcf, 0x3c, 0x00, 0x75, 0x13, 0x83, 0xf9,
+  0x00, 0x75, 0x0e, 0x80, 0xfa, 0x4f, 0x72, 0x09, 0x80, 0xfe, 0x18, 0x72,
+  0x04, 0xe8, 0x24, 0x08, 0xcf, 0x53, 0x50, 0x1e, 0x06, 0x51, 0x52, 0x56,
+  0x57, 0x53, 0xbb, 0x00, 0xb8, 0x8e, 0xc3, 0x8e, 0xdb, 0x5b, 0x88, 0xc3,
+  0x80, 0xfb, 0x00, 0x74, 0x4c, 0x53, 0x52, 0xb8, 0x00, 0x00, 0x88, 0xe8,
+  0xbb, 0x50, 0x00, 0xf7, 0xe3, 0x00, 0xc8, 0x80, 0xd4, 0x00, 0xbb, 0x02,
+  0x00, 0xf7, 0xe3, 0x5a, 0x5b, 0x89, 0xc7, 0x89, 0xc6, 0x81, 0xc6, 0xa0,
+  0x00, 0xb8, 0x00, 0x00, 0x00, 0xd0, 0x80, 0xd4, 0x00, 0x40, 0x28, 0xc8,
+  0x80, 0xdc, 0x00, 0x38, 0xf5, 0x73, 0x0b, 0x51, 0x89, 0xc1, 0xfc, 0xf3,
+  0xa5, 0x59, 0xfe, 0xc5, 0xeb, 0xc3, 0x51, 0x89, 0xc1, 0x88, 0xfc, 0xb0,
+  0x00, 0xfc, 0xf3, 0xab, 0x59, 0xfe, 0xcb, 0xeb, 0xaf, 0x5f, 0x5e, 0x5a,
+  0x59, 0x07, 0x1f, 0x58, 0x5b, 0xcf, 0x3c, 0x00, 0x75, 0x13, 0x83, 0xf9,
+  0x00, 0x75, 0x0e, 0x80, 0xfa, 0x4f, 0x75, 0x09, 0x80, 0xfe, 0x18, 0x7c,
+  0x04, 0xe8, 0xa0, 0x07, 0xcf, 0x50, 0x53, 0x1e, 0x06, 0x51, 0x52, 0x56,
+  0x57, 0x53, 0xbb, 0x00, 0xb8, 0x8e, 0xc3, 0x8e, 0xdb, 0x5b, 0x88, 0xc3,
+  0x80, 0xfb, 0x00, 0x74, 0x4a, 0x53, 0x52, 0xb8, 0x00, 0x00, 0x88, 0xf0,
+  0xbb, 0x50, 0x00, 0xf7, 0xe3, 0x00, 0xc8, 0x80, 0xd4, 0x00, 0xbb, 0x02,
+  0x00, 0xf7, 0xe3, 0x5a, 0x5b, 0x89, 0xc7, 0x89, 0xc6, 0x81, 0xee, 0xa0,
+  0x00, 0xb8, 0x00, 0x00, 0x00, 0xd0, 0x80, 0xd4, 0x00, 0x40, 0x28, 0xc8,
+  0x80, 0xdc, 0x00, 0x38, 0xf5, 0x73, 0x0a, 0x51, 0x89, 0xc1, 0xf3, 0xa5,
+  0x59, 0xfe, 0xce, 0xeb, 0xc4, 0x51, 0x89, 0xc1, 0x88, 0xfc, 0xb0, 0x00,
+  0xf3, 0xab, 0x59, 0xfe, 0xcb, 0xeb, 0xb1, 0x5f, 0x5e, 0x5a, 0x59, 0x07,
+  0x1f, 0x5b, 0x58, 0xcf, 0x1e, 0x06, 0x53, 0x52, 0xbb, 0x40, 0x00, 0x8e,
+  0xc3, 0xbb, 0x00, 0xb8, 0x8e, 0xdb, 0xbb, 0xa0, 0x00, 0xb8, 0x00, 0x00,
+  0x26, 0xa0, 0x51, 0x00, 0xf7, 0xe3, 0xbb, 0x00, 0x00, 0x26, 0x8a, 0x1e,
+  0x50, 0x00, 0x01, 0xd8, 0x01, 0xd8, 0x89, 0xc3, 0xb4, 0x07, 0x8a, 0x07,
+  0x5a, 0x5b, 0x07, 0x1f, 0xcf, 0xcf, 0x1e, 0x06, 0x51, 0x52, 0x50, 0x55,
+  0x53, 0x50, 0xbb, 0x40, 0x00, 0x8e, 0xc3, 0x88, 0xc1, 0xb5, 0x07, 0xbb,
+  0x00, 0xb8, 0x8e, 0xdb, 0x3c, 0x20, 0x7c, 0x2f, 0x26, 0x80, 0x3e, 0x49,
+  0x00, 0x04, 0x74, 0x24, 0x26, 0x80, 0x3e, 0x49, 0x00, 0x05, 0x74, 0x1c,
+  0xbb, 0xa0, 0x00, 0xb8, 0x00, 0x00, 0x26, 0xa0, 0x51, 0x00, 0xf7, 0xe3,
+  0xbb, 0x00, 0x00, 0x26, 0x8a, 0x1e, 0x50, 0x00, 0xd1, 0xe3, 0x01, 0xc3,
+  0x89, 0x0f, 0xeb, 0x03, 0xe8, 0xbe, 0x00, 0x58, 0x50, 0xeb, 0x39, 0x1e,
+  0x06, 0x51, 0x52, 0x50, 0x55, 0x53, 0x50, 0x88, 0xc2, 0x88, 0xde, 0xbb,
+  0x40, 0x00, 0x8e, 0xc3, 0xbb, 0x00, 0xb8, 0x8e, 0xdb, 0xbb, 0xa0, 0x00,
+  0xb8, 0x00, 0x00, 0x26, 0xa0, 0x51, 0x00, 0xf7, 0xe3, 0xbb, 0x00, 0x00,
+  0x26, 0x8a, 0x1e, 0x50, 0x00, 0xd1, 0xe3, 0x01, 0xc3, 0x89, 0x17, 0x83,
+  0xc3, 0x02, 0x49, 0x83, 0xf9, 0x00, 0x75, 0xf5, 0x58, 0x06, 0x1f, 0x3c,
+  0x08, 0x75, 0x1b, 0xfe, 0x0e, 0x50, 0x00, 0xfe, 0x0e, 0x9d, 0x00, 0x80,
+  0x3e, 0x50, 0x00, 0x00, 0x7f, 0x63, 0xc6, 0x06, 0x50, 0x00, 0x00, 0xc6,
+  0x06, 0x9d, 0x00, 0x00, 0xeb, 0x57, 0x3c, 0x0a, 0x74, 0x21, 0x3c, 0x0d,
+  0x75, 0x0c, 0xc6, 0x06, 0x50, 0x00, 0x00, 0xc6, 0x06, 0x9d, 0x00, 0x00,
+  0xeb, 0x43, 0xfe, 0x06, 0x50, 0x00, 0xfe, 0x06, 0x9d, 0x00, 0x80, 0x3e,
+  0x50, 0x00, 0x50, 0x7d, 0x02, 0xeb, 0x32, 0xc6, 0x06, 0x50, 0x00, 0x00,
+  0xc6, 0x06, 0x9d, 0x00, 0x00, 0xfe, 0x06, 0x51, 0x00, 0xfe, 0x06, 0x9e,
+  0x00, 0x80, 0x3e, 0x51, 0x00, 0x19, 0x72, 0x19, 0xc6, 0x06, 0x51, 0x00,
+  0x18, 0xc6, 0x06, 0x9e, 0x00, 0x18, 0xb7, 0x07, 0xb0, 0x01, 0xb9, 0x00,
+  0x00, 0xba, 0x4f, 0x18, 0x9c, 0x0e, 0xe8, 0xc9, 0xfd, 0x5b, 0x5d, 0x58,
+  0x5a, 0x59, 0x07, 0x1f, 0xcf, 0x50, 0x53, 0x51, 0x1e, 0x06, 0x57, 0x55,
+  0x80, 0xfc, 0x01, 0x75, 0x04, 0xb7, 0x55, 0xeb, 0x0b, 0x80, 0xfc, 0x02,
+  0x75, 0x04, 0xb7, 0xaa, 0xeb, 0x02, 0xb7, 0xff, 0xa8, 0x80, 0x75, 0x11,
+  0xb4, 0x00, 0xd1, 0xe0, 0xd1, 0xe0, 0xd1, 0xe0, 0x05, 0xa5, 0x0f, 0x89,
+  0xc5, 0x8c, 0xc9, 0xeb, 0x1c, 0x24, 0x7f, 0xb4, 0x00, 0xd1, 0xe0, 0xd1,
+  0xe0, 0xd1, 0xe0, 0x89, 0xc5, 0xb8, 0x00, 0x00, 0x8e, 0xd8, 0x3e, 0xa1,
+  0x7c, 0x00, 0x01, 0xc5, 0x3e, 0x8b, 0x0e, 0x7e, 0x00, 0xb8, 0x40, 0x00,
+  0x8e, 0xd8, 0xb0, 0x50, 0x3e, 0xf6, 0x26, 0x51, 0x00, 0xd1, 0xe0, 0xd1,
+  0xe0, 0x3e, 0x02, 0x06, 0x50, 0x00, 0x80, 0xd4, 0x00, 0x3e, 0x02, 0x06,
+  0x50, 0x00, 0x80, 0xd4, 0x00, 0x89, 0xc7, 0x8e, 0xd9, 0xb8, 0x00, 0xb8,
+  0x8e, 0xc0, 0x57, 0x3e, 0x8a, 0x5e, 0x00, 0xe8, 0x59, 0x00, 0xab, 0x83,
+  0xc7, 0x4e, 0x3e, 0x8a, 0x5e, 0x02, 0xe8, 0x4e, 0x00, 0xab, 0x83, 0xc7,
+  0x4e, 0x3e, 0x8a, 0x5e, 0x04, 0xe8, 0x43, 0x00, 0xab, 0x83, 0xc7, 0x4e,
+  0x3e, 0x8a, 0x5e, 0x06, 0xe8, 0x38, 0x00, 0xab, 0xb8, 0x00, 0xba, 0x8e,
+  0xc0, 0x5f, 0x3e, 0x8a, 0x5e, 0x01, 0xe8, 0x2a, 0x00, 0xab, 0x83, 0xc7,
+  0x4e, 0x3e, 0x8a, 0x5e, 0x03, 0xe8, 0x1f, 0x00, 0xab, 0x83, 0xc7, 0x4e,
+  0x3e, 0x8a, 0x5e, 0x05, 0xe8, 0x14, 0x00, 0xab, 0x83, 0xc7, 0x4e, 0x3e,
+  0x8a, 0x5e, 0x07, 0xe8, 0x09, 0x00, 0xab, 0x5d, 0x5f, 0x07, 0x1f, 0x59,
+  0x5b, 0x58, 0xc3, 0xb8, 0x00, 0x00, 0xf6, 0xc3, 0x80, 0x74, 0x02, 0x0c,
+  0xc0, 0xf6, 0xc3, 0x40, 0x74, 0x02, 0x0c, 0x30, 0xf6, 0xc3, 0x20, 0x74,
+  0x02, 0x0c, 0x0c, 0xf6, 0xc3, 0x10, 0x74, 0x02, 0x0c, 0x03, 0xf6, 0xc3,
+  0x08, 0x74, 0x03, 0x80, 0xcc, 0xc0, 0xf6, 0xc3, 0x04, 0x74, 0x03, 0x80,
+  0xcc, 0x30, 0xf6, 0xc3, 0x02, 0x74, 0x03, 0x80, 0xcc, 0x0c, 0xf6, 0xc3,
+  0x01, 0x74, 0x03, 0x80, 0xcc, 0x03, 0x20, 0xf8, 0x20, 0xfc, 0xc3, 0x06,
+  0xb8, 0x40, 0x00, 0x8e, 0xc0, 0xb4, 0x50, 0x26, 0xa0, 0x49, 0x00, 0xb7,
+  0x00, 0x07, 0xcf, 0x2e, 0xa1, 0x3a, 0x0e, 0xcf, 0xb8, 0x80, 0x02, 0xcf,
+  0x80, 0xfc, 0x00, 0x74, 0x62, 0x80, 0xfc, 0x01, 0x74, 0x60, 0x80, 0xfa,
+  0x80, 0x75, 0x0d, 0x2e, 0x83, 0x3e, 0xf6, 0x0c, 0x02, 0x7d, 0x05, 0xb4,
+  0x0f, 0xe9, 0xe8, 0x04, 0x80, 0xfc, 0x02, 0x74, 0x54, 0x80, 0xfc, 0x03,
+  0x75, 0x03, 0xe9, 0xb5, 0x00, 0x80, 0xfc, 0x04, 0x75, 0x03, 0xe9, 0x10,
+  0x01, 0x80, 0xfc, 0x05, 0x75, 0x03, 0xe9, 0x7f, 0x01, 0x80, 0xfc, 0x08,
+  0x75, 0x03, 0xe9, 0x05, 0x01, 0x80, 0xfc, 0x0c, 0x75, 0x03, 0xe9, 0x55,
+  0x01, 0x80, 0xfc, 0x10, 0x75, 0x03, 0xe9, 0x52, 0x01, 0x80, 0xfc, 0x15,
+  0x75, 0x03, 0xe9, 0x64, 0x01, 0x80, 0xfc, 0x16, 0x75, 0x03, 0xe9, 0x84,
+  0x01, 0xb4, 0x01, 0xe9, 0x9e, 0x04, 0xcf, 0xe9, 0xa3, 0x04, 0x2e, 0x8a,
+  0x26, 0x6b, 0x0e, 0x74, 0x02, 0xf9, 0xcf, 0xf8, 0xcf, 0x52, 0x80, 0xfa,
+  0x00, 0x74, 0x0b, 0x80, 0xfa, 0x80, 0x74, 0x15, 0x5a, 0xb4, 0x01, 0xe9,
+  0x7e, 0x04, 0x56, 0x55, 0x2e, 0x3a, 0x0e, 0xcf, 0x0c, 0x77, 0x41, 0x5d,
+  0x5e, 0xb2, 0x01, 0xeb, 0x02, 0xb2, 0x00, 0x56, 0x55, 0xe8, 0xbf, 0x03,
+  0xb4, 0x00, 0xc1, 0xe0, 0x09, 0x0f, 0x03, 0xc1, 0xe8, 0x09, 0xb4, 0x02,
+  0x3c, 0x00, 0x74, 0x24, 0x83, 0xfa, 0x01, 0x75, 0x1a, 0x83, 0xf9, 0x01,
+  0x75, 0x15, 0x50, 0x26, 0x8a, 0x47, 0x18, 0x3c, 0x09, 0x74, 0x07, 0x3c,
+  0x12, 0x74, 0x03, 0x58, 0xeb, 0x05, 0x2e, 0xa2, 0xcf, 0x0c, 0x58, 0xf8,
+  0xb4, 0x00, 0xeb, 0x03, 0xf9, 0xb4, 0x04, 0x5d, 0x5e, 0x5a, 0x2e, 0x88,
+  0x26, 0x6b, 0x0e, 0xe9, 0x38, 0x04, 0x52, 0x80, 0xfa, 0x00, 0x74, 0x0b,
+  0x80, 0xfa, 0x80, 0x74, 0x0a, 0x5a, 0xb4, 0x01, 0xe9, 0x15, 0x04, 0xb2,
+  0x01, 0xeb, 0x02, 0xb2, 0x00, 0x56, 0x55, 0x51, 0x57, 0xe8, 0x5f, 0x03,
+  0x80, 0xfa, 0x00, 0x75, 0x1b, 0x89, 0xe9, 0x89, 0xf7, 0xb4, 0x00, 0x01,
+  0xc1, 0x83, 0xd7, 0x00, 0x2e, 0x3b, 0x3e, 0xf8, 0x0c, 0x77, 0x1e, 0x72,
+  0x07, 0x2e, 0x3b, 0x0e, 0xfa, 0x0c, 0x77, 0x15, 0xb4, 0x00, 0xc1, 0xe0,
+  0x09, 0x0f, 0x04, 0xc1, 0xe8, 0x09, 0xb4, 0x03, 0x3c, 0x00, 0x74, 0x05,
+  0xf8, 0xb4, 0x00, 0xeb, 0x03, 0xf9, 0xb4, 0x04, 0x5f, 0x59, 0x5d, 0x5e,
+  0x5a, 0x2e, 0x88, 0x26, 0x6b, 0x0e, 0xe9, 0xd5, 0x03, 0xb4, 0x00, 0xe9,
+  0xc7, 0x03, 0x80, 0xfa, 0x00, 0x74, 0x0f, 0x80, 0xfa, 0x80, 0x74, 0x28,
+  0xb4, 0x01, 0x2e, 0x88, 0x26, 0x6b, 0x0e, 0xe9, 0xaa, 0x03, 0x0e, 0x07,
+  0xbf, 0xcb, 0x0c, 0xb8, 0x00, 0x00, 0xbb, 0x04, 0x00, 0xb5, 0x4f, 0x2e,
+  0x8a, 0x0e, 0xcf, 0x0c, 0xba, 0x01, 0x01, 0x2e, 0xc6, 0x06, 0x6b, 0x0e,
+  0x00, 0xe9, 0x95, 0x03, 0xb8, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xb2, 0x01,
+  0x2e, 0x8a, 0x36, 0x00, 0x0d, 0x2e, 0x8b, 0x0e, 0xfe, 0x0c, 0xd0, 0xcd,
+  0xd0, 0xcd, 0x2e, 0x02, 0x2e, 0xfc, 0x0c, 0x86, 0xe9, 0x2e, 0xc6, 0x06,
+  0x6b, 0x0e, 0x00, 0xe9, 0x6f, 0x03, 0xb4, 0x00, 0xe9, 0x6a, 0x03, 0x2e,
+  0x80, 0x3e, 0xf6, 0x0c, 0x02, 0x75, 0x0a, 0x80, 0xfa, 0x80, 0x75, 0x05,
+  0xb4, 0x00, 0xe9, 0x58, 0x03, 0xe9, 0x4c, 0x03, 0xb4, 0x00, 0xe9, 0x50,
+  0x03, 0x80, 0xfa, 0x00, 0x74, 0x0f, 0x80, 0xfa, 0x80, 0x74, 0x0f, 0xb4,
+  0x0f, 0x2e, 0x88, 0x26, 0x6b, 0x0e, 0xe9, 0x33, 0x03, 0xb4, 0x01, 0xe9,
+  0x37, 0x03, 0xb4, 0x03, 0x2e, 0x8b, 0x0e, 0xf8, 0x0c, 0x2e, 0x8b, 0x16,
+  0xfa, 0x0c, 0xe9, 0x28, 0x03, 0xb4, 0x00, 0xe9, 0x23, 0x03, 0x0f, 0x05,
+  0xe9, 0x15, 0x03, 0x80, 0xfc, 0x84, 0x74, 0x02, 0xeb, 0x37, 0x50, 0xb0,
+  0x01, 0xb4, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x58, 0x74, 0x2b, 0x83, 0xfa,
+  0x00, 0x74, 0x07, 0x83, 0xfa, 0x01, 0x74, 0x11, 0xeb, 0x1f, 0x53, 0x51,
+  0xb0, 0x01, 0xb4, 0x01, 0x0f, 0x00, 0xc0, 0xe0, 0x04, 0x59, 0x5b, 0xeb,
+  0x0d, 0xb0, 0x01, 0xb4, 0x01, 0x0f, 0x00, 0x89, 0xd8, 0x89, 0xcb, 0xba,
+  0x00, 0x00, 0xe9, 0xe0, 0x02, 0xb4, 0x86, 0xe9, 0xd2, 0x02, 0x80, 0xfc,
+  0x00, 0x74, 0x10, 0x80, 0xfc, 0x01, 0x74, 0x39, 0x80, 0xfc, 0x02, 0x74,
+  0x58, 0x80, 0xfc, 0x12, 0x74, 0x61, 0xcf, 0x06, 0x53, 0x51, 0x52, 0xbb,
+  0x40, 0x00, 0x8e, 0xc3, 0xfa, 0x26, 0x8b, 0x0e, 0x1c, 0x00, 0x26, 0x8b,
+  0x1e, 0x1a, 0x00, 0x26, 0x8b, 0x17, 0xfb, 0x39, 0xd9, 0x74, 0xed, 0x26,
+  0x83, 0x06, 0x1a, 0x00, 0x02, 0xe8, 0xc0, 0x01, 0x88, 0xf4, 0x88, 0xd0,
+  0x5a, 0x59, 0x5b, 0x07, 0xcf, 0x06, 0x53, 0x51, 0x52, 0xbb, 0x40, 0x00,
+  0x8e, 0xc3, 0x26, 0x8b, 0x0e, 0x1c, 0x00, 0x26, 0x8b, 0x1e, 0x1a, 0x00,
+  0x26, 0x8b, 0x17, 0xfb, 0x39, 0xd9, 0x88, 0xf4, 0x88, 0xd0, 0x5a, 0x59,
+  0x5b, 0x07, 0xca, 0x02, 0x00, 0x06, 0x53, 0xbb, 0x40, 0x00, 0x8e, 0xc3,
+  0x26, 0xa0, 0x17, 0x00, 0x5b, 0x07, 0xcf, 0x06, 0x53, 0xbb, 0x40, 0x00,
+  0x8e, 0xc3, 0x26, 0xa0, 0x17, 0x00, 0x88, 0xc4, 0x5b, 0x07, 0xcf, 0x80,
+  0xfc, 0x01, 0x74, 0x03, 0xe9, 0x45, 0x02, 0xb4, 0x01, 0xe9, 0x40, 0x02,
+  0xe9, 0x46, 0xf6, 0x80, 0xfc, 0x00, 0x74, 0x16, 0x80, 0xfc, 0x02, 0x74,
+  0x70, 0x80, 0xfc, 0x04, 0x75, 0x03, 0xe9, 0xa4, 0x00, 0x80, 0xfc, 0x0f,
+  0x75, 0x03, 0xe9, 0xd6, 0x00, 0xcf, 0x50, 0x53, 0x1e, 0x06, 0x0e, 0x0e,
+  0x1f, 0x07, 0xbb, 0xa5, 0x17, 0x0f, 0x02, 0xb8, 0xb6, 0x00, 0xf7, 0x26,
+  0xc9, 0x17, 0xbb, 0x10, 0x27, 0xf7, 0xf3, 0xa3, 0xc9, 0x17, 0xb8, 0xb6,
+  0x00, 0xf7, 0x26, 0xa5, 0x17, 0xbb, 0x0a, 0x00, 0xba, 0x00, 0x00, 0xf7,
+  0xf3, 0xa3, 0xa5, 0x17, 0xb8, 0x44, 0x04, 0xf7, 0x26, 0xa9, 0x17, 0xa3,
+  0xa9, 0x17, 0xb8, 0xf0, 0xff, 0xf7, 0x26, 0xad, 0x17, 0x03, 0x06, 0xc9,
+  0x17, 0x83, 0xd2, 0x00, 0x03, 0x06, 0xa5, 0x17, 0x83, 0xd2, 0x00, 0x03,
+  0x06, 0xa9, 0x17, 0x83, 0xd2, 0x00, 0x52, 0x50, 0x5a, 0x59, 0x07, 0x1f,
+  0x5b, 0x58, 0xb0, 0x00, 0xcf, 0x1e, 0x06, 0x50, 0x53, 0x0e, 0x0e, 0x1f,
+  0x07, 0xbb, 0xa5, 0x17, 0x0f, 0x02, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0xad,
+  0x17, 0xe8, 0xa5, 0x00, 0x88, 0xc7, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0xa9,
+  0x17, 0xe8, 0x99, 0x00, 0x88, 0xc3, 0xb8, 0x00, 0x00, 0x8b, 0x0e, 0xa5,
+  0x17, 0xe8, 0x8d, 0x00, 0x88, 0xc6, 0xb2, 0x00, 0x89, 0xd9, 0x5b, 0x58,
+  0x07, 0x1f, 0xe9, 0x90, 0x01, 0x1e, 0x06, 0x53, 0x50, 0x0e, 0x0e, 0x1f,
+  0x07, 0xbb, 0xa5, 0x17, 0x0f, 0x02, 0xb8, 0x00, 0x19, 0x8b, 0x0e, 0xb9,
+  0x17, 0xe8, 0x69, 0x00, 0x89, 0xc1, 0x51, 0xb8, 0x01, 0x00, 0x8b, 0x0e,
+  0xb5, 0x17, 0xe8, 0x5c, 0x00, 0x88, 0xc6, 0xb8, 0x00, 0x00, 0x8b, 0x0e,
+  0xb1, 0x17, 0xe8, 0x50, 0x00, 0x88, 0xc2, 0x59, 0x58, 0x5b, 0x07, 0x1f,
+  0xe9, 0x56, 0x01, 0xe9, 0x53, 0x01, 0xcf, 0xdf, 0x02, 0x25, 0x02, 0x12,
+  0x1b, 0xff, 0x54, 0xf6, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0xfe, 0x41, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
-  0x53, 0xe3, 0x2a, 0x40, 0x88, 0xc7, 0x80, 0xe7, 0x0f, 0x80, 0xff, 0x0a,
-  0x75, 0x03, 0x83, 0xc0, 0x06, 0x88, 0xc7, 0x80, 0xe7, 0xf0, 0x80, 0xff,
-  0xa0, 0x75, 0x03, 0x83, 0xc0, 0x60, 0x88, 0xe7, 0x80, 0xe7, 0x0f, 0x80,
-  0xff, 0x0a, 0x75, 0x03, 0x05, 0x00, 0x06, 0xe2, 0xd6, 0x5b, 0xc3, 0x50,
-  0x53, 0x26, 0xa1, 0x82, 0x00, 0x26, 0x39, 0x06, 0x1a, 0x00, 0x7c, 0x0a,
-  0x26, 0x8b, 0x1e, 0x80, 0x00, 0x26, 0x89, 0x1e, 0x1a, 0x00, 0x26, 0xa1,
-  0x82, 0x00, 0x26, 0x39, 0x06, 0x1c, 0x00, 0x7c, 0x0a, 0x26, 0x8b, 0x1e,
-  0x80, 0x00, 0x26, 0x89, 0x1e, 0x1c, 0x00, 0x5b, 0x58, 0xc3, 0x50, 0x53,
-  0x51, 0x52, 0x2e, 0x88, 0x16, 0x67, 0x0d, 0x51, 0x88, 0xcf, 0xb1, 0x06,
-  0xd2, 0xef, 0x88, 0xeb, 0x2e, 0x80, 0x3e, 0x67, 0x0d, 0x01, 0x52, 0xba,
-  0x00, 0x00, 0x93, 0x75, 0x10, 0xd1, 0xe0, 0x50, 0x31, 0xc0, 0x2e, 0xa0,
-  0x2e, 0x0d, 0x2e, 0xa3, 0x63, 0x0d, 0x58, 0xeb, 0x1a, 0x2e, 0x8b, 0x2e,
-  0x5f, 0x0d, 0x45, 0x2e, 0x89, 0x2e, 0x65, 0x0d, 0x2e, 0xf7, 0x26, 0x65,
-  0x0d, 0x2e, 0x8b, 0x2e, 0x5b, 0x0d, 0x2e, 0x89, 0x2e, 0x63, 0x0d, 0x93,
-  0x5a, 0x86, 0xf2, 0xb6, 0x00, 0x01, 0xd3, 0x2e, 0xa1, 0x63, 0x0d, 0xf7,
-  0xe3, 0x59, 0xb5, 0x00, 0x80, 0xe1, 0x3f, 0xfe, 0xc9, 0x01, 0xc8, 0x83,
-  0xd2, 0x00, 0x89, 0xc5, 0x89, 0xd6, 0x5a, 0x59, 0x5b, 0x58, 0xc3, 0x50,
-  0x50, 0x06, 0xb8, 0x40, 0x00, 0x8e, 0xc0, 0x26, 0xc6, 0x06, 0x50, 0x00,
-  0x00, 0x26, 0xc6, 0x06, 0x9d, 0x00, 0x00, 0x26, 0xc6, 0x06, 0x51, 0x00,
-  0x00, 0x26, 0xc6, 0x06, 0x9e, 0x00, 0x00, 0x07, 0x58, 0x06, 0x57, 0x51,
-  0xfc, 0xb8, 0x00, 0xb8, 0x8e, 0xc0, 0xbf, 0x00, 0x00, 0xb0, 0x00, 0x88,
-  0xfc, 0xb9, 0xd0, 0x07, 0xf3, 0xab, 0x59, 0x5f, 0x07, 0x58, 0xc3, 0x50,
-  0xb0, 0x01, 0xe6, 0x64, 0x58, 0xe6, 0x60, 0xcd, 0x09, 0xc3, 0x87, 0xec,
-  0x83, 0x4e, 0x04, 0x01, 0x87, 0xec, 0xcf, 0x87, 0xec, 0x83, 0x66, 0x04,
-  0xfe, 0x87, 0xec, 0xcf, 0x72, 0xec, 0xeb, 0xf3, 0xf8, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x21, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
-  0x1e, 0x00, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+  0xcf, 0x53, 0xe3, 0x2a, 0x40, 0x88, 0xc7, 0x80, 0xe7, 0x0f, 0x80, 0xff,
+  0x0a, 0x75, 0x03, 0x83, 0xc0, 0x06, 0x88, 0xc7, 0x80, 0xe7, 0xf0, 0x80,
+  0xff, 0xa0, 0x75, 0x03, 0x83, 0xc0, 0x60, 0x88, 0xe7, 0x80, 0xe7, 0x0f,
+  0x80, 0xff, 0x0a, 0x75, 0x03, 0x05, 0x00, 0x06, 0xe2, 0xd6, 0x5b, 0xc3,
+  0x50, 0x53, 0x26, 0xa1, 0x82, 0x00, 0x26, 0x39, 0x06, 0x1a, 0x00, 0x7c,
+  0x0a, 0x26, 0x8b, 0x1e, 0x80, 0x00, 0x26, 0x89, 0x1e, 0x1a, 0x00, 0x26,
+  0xa1, 0x82, 0x00, 0x26, 0x39, 0x06, 0x1c, 0x00, 0x7c, 0x0a, 0x26, 0x8b,
+  0x1e, 0x80, 0x00, 0x26, 0x89, 0x1e, 0x1c, 0x00, 0x5b, 0x58, 0xc3, 0x50,
+  0x53, 0x51, 0x52, 0x2e, 0x88, 0x16, 0x08, 0x0d, 0x51, 0x88, 0xcf, 0xb1,
+  0x06, 0xd2, 0xef, 0x88, 0xeb, 0x2e, 0x80, 0x3e, 0x08, 0x0d, 0x01, 0x52,
+  0xba, 0x00, 0x00, 0x93, 0x75, 0x10, 0xd1, 0xe0, 0x50, 0x31, 0xc0, 0x2e,
+  0xa0, 0xcf, 0x0c, 0x2e, 0xa3, 0x04, 0x0d, 0x58, 0xeb, 0x1a, 0x2e, 0x8b,
+  0x2e, 0x00, 0x0d, 0x45, 0x2e, 0x89, 0x2e, 0x06, 0x0d, 0x2e, 0xf7, 0x26,
+  0x06, 0x0d, 0x2e, 0x8b, 0x2e, 0xfc, 0x0c, 0x2e, 0x89, 0x2e, 0x04, 0x0d,
+  0x93, 0x5a, 0x86, 0xf2, 0xb6, 0x00, 0x01, 0xd3, 0x2e, 0xa1, 0x04, 0x0d,
+  0xf7, 0xe3, 0x59, 0xb5, 0x00, 0x80, 0xe1, 0x3f, 0xfe, 0xc9, 0x01, 0xc8,
+  0x83, 0xd2, 0x00, 0x89, 0xc5, 0x89, 0xd6, 0x5a, 0x59, 0x5b, 0x58, 0xc3,
+  0x50, 0x50, 0x06, 0xb8, 0x40, 0x00, 0x8e, 0xc0, 0x26, 0xc6, 0x06, 0x50,
+  0x00, 0x00, 0x26, 0xc6, 0x06, 0x9d, 0x00, 0x00, 0x26, 0xc6, 0x06, 0x51,
+  0x00, 0x00, 0x26, 0xc6, 0x06, 0x9e, 0x00, 0x00, 0x07, 0x58, 0x06, 0x57,
+  0x51, 0xfc, 0xb8, 0x00, 0xb8, 0x8e, 0xc0, 0xbf, 0x00, 0x00, 0xb0, 0x00,
+  0x88, 0xfc, 0xb9, 0xd0, 0x07, 0xf3, 0xab, 0x59, 0x5f, 0x07, 0x58, 0xc3,
+  0x87, 0xec, 0x83, 0x4e, 0x04, 0x01, 0x87, 0xec, 0xcf, 0x87, 0xec, 0x83,
+  0x66, 0x04, 0xfe, 0x87, 0xec, 0xcf, 0x72, 0xec, 0xeb, 0xf3, 0xf8, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x23, 0x02, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x1e, 0x00, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
   0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
-  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0xd4,
-  0x03, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06,
+  0x00, 0xd4, 0x03, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b,
-  0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0xb8, 0x04, 0x00, 0xf0, 0xf4,
-  0x03, 0x00, 0xf0, 0x46, 0x04, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b, 0x0d, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0xbb, 0x04, 0x00, 0xf0, 0x66, 0x09, 0x00, 0xf0, 0x6b,
-  0x09, 0x00, 0xf0, 0x6f, 0x09, 0x00, 0xf0, 0x59, 0x0b, 0x00, 0xf0, 0x5e,
-  0x0b, 0x00, 0xf0, 0xa1, 0x0b, 0x00, 0xf0, 0x26, 0x0c, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0x33, 0x0c, 0x00, 0xf0, 0x36, 0x0c, 0x00, 0xf0, 0x6b,
-  0x0d, 0x00, 0xf0, 0x29, 0x0d, 0x00, 0xf0, 0x02, 0x03, 0x00, 0xf0, 0x2a,
-  0x0d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
-  0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e, 0x7e, 0xff, 0xdb, 0xff, 0xc3,
-  0xe7, 0xff, 0x7e, 0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x10,
-  0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x38, 0x7c, 0x38, 0xfe, 0xfe,
-  0xd6, 0x10, 0x38, 0x10, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x10, 0x38, 0x00,
-  0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0xff, 0xff, 0xe7, 0xc3, 0xc3,
-  0xe7, 0xff, 0xff, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00, 0xff,
-  0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0x0f, 0x03, 0x05, 0x7d, 0x84,
-  0x84, 0x84, 0x78, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x18, 0x7e, 0x18, 0x3f,
-  0x21, 0x3f, 0x20, 0x20, 0x60, 0xe0, 0xc0, 0x3f, 0x21, 0x3f, 0x21, 0x23,
-  0x67, 0xe6, 0xc0, 0x18, 0xdb, 0x3c, 0xe7, 0xe7, 0x3c, 0xdb, 0x18, 0x80,
-  0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 0x02, 0x0e, 0x3e, 0xfe, 0x3e,
-  0x0e, 0x02, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x24,
-  0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x00, 0x7f, 0x92, 0x92, 0x72, 0x12,
-  0x12, 0x12, 0x00, 0x3e, 0x63, 0x38, 0x44, 0x44, 0x38, 0xcc, 0x78, 0x00,
-  0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x7e,
-  0x3c, 0x18, 0xff, 0x10, 0x38, 0x7c, 0x54, 0x10, 0x10, 0x10, 0x00, 0x10,
-  0x10, 0x10, 0x54, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x18, 0x0c, 0xfe, 0x0c,
-  0x18, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe, 0x60, 0x30, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x40, 0x40, 0x7e, 0x00, 0x00, 0x00, 0x24, 0x66, 0xff, 0x66,
-  0x24, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x00, 0x00, 0x00,
-  0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x10, 0x10, 0x00, 0x10, 0x00, 0x24,
-  0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x7e, 0x24, 0x7e,
-  0x24, 0x24, 0x00, 0x18, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x18, 0x00, 0x00,
-  0x62, 0x64, 0x08, 0x10, 0x26, 0x46, 0x00, 0x30, 0x48, 0x30, 0x56, 0x88,
-  0x88, 0x76, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00, 0x20, 0x10, 0x08, 0x08, 0x08,
-  0x10, 0x20, 0x00, 0x00, 0x44, 0x38, 0xfe, 0x38, 0x44, 0x00, 0x00, 0x00,
-  0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10,
-  0x20, 0x40, 0x00, 0x3c, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x3c, 0x00, 0x10,
-  0x30, 0x50, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x3c, 0x42, 0x02, 0x0c, 0x30,
-  0x42, 0x7e, 0x00, 0x3c, 0x42, 0x02, 0x1c, 0x02, 0x42, 0x3c, 0x00, 0x08,
-  0x18, 0x28, 0x48, 0xfe, 0x08, 0x1c, 0x00, 0x7e, 0x40, 0x7c, 0x02, 0x02,
-  0x42, 0x3c, 0x00, 0x1c, 0x20, 0x40, 0x7c, 0x42, 0x42, 0x3c, 0x00, 0x7e,
-  0x42, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x42,
-  0x42, 0x3c, 0x00, 0x3c, 0x42, 0x42, 0x3e, 0x02, 0x04, 0x38, 0x00, 0x00,
-  0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
-  0x10, 0x10, 0x20, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,
-  0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x04,
-  0x08, 0x10, 0x00, 0x3c, 0x42, 0x02, 0x04, 0x08, 0x00, 0x08, 0x00, 0x3c,
-  0x42, 0x5e, 0x52, 0x5e, 0x40, 0x3c, 0x00, 0x18, 0x24, 0x42, 0x42, 0x7e,
-  0x42, 0x42, 0x00, 0x7c, 0x22, 0x22, 0x3c, 0x22, 0x22, 0x7c, 0x00, 0x1c,
-  0x22, 0x40, 0x40, 0x40, 0x22, 0x1c, 0x00, 0x78, 0x24, 0x22, 0x22, 0x22,
-  0x24, 0x78, 0x00, 0x7e, 0x22, 0x28, 0x38, 0x28, 0x22, 0x7e, 0x00, 0x7e,
-  0x22, 0x28, 0x38, 0x28, 0x20, 0x70, 0x00, 0x1c, 0x22, 0x40, 0x40, 0x4e,
-  0x22, 0x1e, 0x00, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x00, 0x38,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x44,
-  0x44, 0x38, 0x00, 0x62, 0x24, 0x28, 0x30, 0x28, 0x24, 0x63, 0x00, 0x70,
-  0x20, 0x20, 0x20, 0x20, 0x22, 0x7e, 0x00, 0x63, 0x55, 0x49, 0x41, 0x41,
-  0x41, 0x41, 0x00, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x42, 0x00, 0x18,
-  0x24, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00, 0x7c, 0x22, 0x22, 0x3c, 0x20,
-  0x20, 0x70, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x4a, 0x3c, 0x03, 0x00, 0x7c,
-  0x22, 0x22, 0x3c, 0x28, 0x24, 0x72, 0x00, 0x3c, 0x42, 0x40, 0x3c, 0x02,
-  0x42, 0x3c, 0x00, 0x7f, 0x49, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x42,
-  0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x41, 0x41, 0x41, 0x41, 0x22,
-  0x14, 0x08, 0x00, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00, 0x41,
-  0x22, 0x14, 0x08, 0x14, 0x22, 0x41, 0x00, 0x41, 0x22, 0x14, 0x08, 0x08,
-  0x08, 0x1c, 0x00, 0x7f, 0x42, 0x04, 0x08, 0x10, 0x21, 0x7f, 0x00, 0x78,
-  0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08,
-  0x04, 0x02, 0x00, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00, 0x10,
-  0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3c, 0x02, 0x3e, 0x42, 0x3f, 0x00, 0x60, 0x20, 0x20, 0x2e, 0x31,
-  0x31, 0x2e, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x42, 0x3c, 0x00, 0x06,
-  0x02, 0x02, 0x3a, 0x46, 0x46, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x7e,
-  0x40, 0x3c, 0x00, 0x0c, 0x12, 0x10, 0x38, 0x10, 0x10, 0x38, 0x00, 0x00,
-  0x00, 0x3d, 0x42, 0x42, 0x3e, 0x02, 0x7c, 0x60, 0x20, 0x2c, 0x32, 0x22,
-  0x22, 0x62, 0x00, 0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00, 0x02,
-  0x00, 0x06, 0x02, 0x02, 0x42, 0x42, 0x3c, 0x60, 0x20, 0x24, 0x28, 0x30,
-  0x28, 0x26, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00,
-  0x00, 0x76, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x5c, 0x62, 0x42,
-  0x42, 0x42, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00,
-  0x00, 0x6c, 0x32, 0x32, 0x2c, 0x20, 0x70, 0x00, 0x00, 0x36, 0x4c, 0x4c,
-  0x34, 0x04, 0x0e, 0x00, 0x00, 0x6c, 0x32, 0x22, 0x20, 0x70, 0x00, 0x00,
-  0x00, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10,
-  0x12, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x46, 0x3a, 0x00, 0x00,
-  0x00, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, 0x41, 0x49, 0x49,
-  0x49, 0x36, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,
-  0x00, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x7c, 0x00, 0x00, 0x7c, 0x08, 0x10,
-  0x20, 0x7c, 0x00, 0x0c, 0x10, 0x10, 0x60, 0x10, 0x10, 0x0c, 0x00, 0x10,
-  0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00, 0x30, 0x08, 0x08, 0x06, 0x08,
-  0x08, 0x30, 0x00, 0x32, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x14, 0x22, 0x41, 0x41, 0x7f, 0x00, 0x3c, 0x42, 0x40, 0x42, 0x3c,
-  0x0c, 0x02, 0x3c, 0x00, 0x44, 0x00, 0x44, 0x44, 0x44, 0x3e, 0x00, 0x0c,
-  0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00, 0x3c, 0x42, 0x38, 0x04, 0x3c,
-  0x44, 0x3e, 0x00, 0x42, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00, 0x30,
-  0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00, 0x10, 0x00, 0x38, 0x04, 0x3c,
-  0x44, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x3c, 0x06, 0x1c, 0x3c,
-  0x42, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00, 0x42, 0x00, 0x3c, 0x42, 0x7e,
-  0x40, 0x3c, 0x00, 0x30, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00, 0x24,
-  0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x7c, 0x82, 0x30, 0x10, 0x10,
-  0x10, 0x38, 0x00, 0x30, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x42,
-  0x18, 0x24, 0x42, 0x7e, 0x42, 0x42, 0x00, 0x18, 0x18, 0x00, 0x3c, 0x42,
-  0x7e, 0x42, 0x00, 0x0c, 0x00, 0x7c, 0x20, 0x38, 0x20, 0x7c, 0x00, 0x00,
-  0x00, 0x33, 0x0c, 0x3f, 0x44, 0x3b, 0x00, 0x1f, 0x24, 0x44, 0x7f, 0x44,
-  0x44, 0x47, 0x00, 0x18, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x00,
-  0x42, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x20, 0x10, 0x00, 0x3c, 0x42,
-  0x42, 0x3c, 0x00, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x20,
-  0x10, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x42, 0x00, 0x42, 0x42,
-  0x3e, 0x02, 0x3c, 0x42, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00, 0x42,
-  0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x08, 0x08, 0x3e, 0x40, 0x40,
-  0x3e, 0x08, 0x08, 0x18, 0x24, 0x20, 0x70, 0x20, 0x42, 0x7c, 0x00, 0x44,
-  0x28, 0x7c, 0x10, 0x7c, 0x10, 0x10, 0x00, 0xf8, 0x4c, 0x78, 0x44, 0x4f,
-  0x44, 0x45, 0xe6, 0x1c, 0x12, 0x10, 0x7c, 0x10, 0x10, 0x90, 0x60, 0x0c,
-  0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00, 0x0c, 0x00, 0x18, 0x08, 0x08,
-  0x08, 0x1c, 0x00, 0x04, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x00,
-  0x04, 0x08, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x32, 0x4c, 0x00, 0x7c, 0x42,
-  0x42, 0x42, 0x00, 0x34, 0x4c, 0x00, 0x62, 0x52, 0x4a, 0x46, 0x00, 0x3c,
-  0x44, 0x44, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x38, 0x44, 0x44, 0x38, 0x00,
-  0x7c, 0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x40, 0x42, 0x3c, 0x00, 0x00,
-  0x00, 0x00, 0x7e, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x02,
-  0x02, 0x00, 0x00, 0x42, 0xc4, 0x48, 0xf6, 0x29, 0x43, 0x8c, 0x1f, 0x42,
-  0xc4, 0x4a, 0xf6, 0x2a, 0x5f, 0x82, 0x02, 0x00, 0x10, 0x00, 0x10, 0x10,
-  0x10, 0x10, 0x00, 0x00, 0x12, 0x24, 0x48, 0x24, 0x12, 0x00, 0x00, 0x00,
-  0x48, 0x24, 0x12, 0x24, 0x48, 0x00, 0x00, 0x22, 0x88, 0x22, 0x88, 0x22,
-  0x88, 0x22, 0x88, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0xdb,
-  0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee, 0x10, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0xf4,
-  0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x14, 0x14, 0x14, 0x00,
-  0x00, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x14, 0x14, 0xf4, 0x04, 0xf4,
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
-  0x00, 0xfc, 0x04, 0xf4, 0x14, 0x14, 0x14, 0x14, 0x14, 0xf4, 0x04, 0xfc,
-  0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0xfc, 0x00, 0x00, 0x00, 0x10,
-  0x10, 0xf0, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x10,
-  0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0xff,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x14,
-  0x14, 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x17, 0x10, 0x1f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x17, 0x14, 0x14, 0x14, 0x14,
-  0x14, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7,
-  0x14, 0x14, 0x14, 0x14, 0x14, 0x17, 0x10, 0x17, 0x14, 0x14, 0x14, 0x00,
-  0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x14, 0xf7, 0x00, 0xf7,
-  0x14, 0x14, 0x14, 0x10, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14,
-  0x14, 0x14, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
-  0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14, 0x14, 0x14,
-  0x14, 0x14, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x10, 0x1f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff,
-  0x14, 0x14, 0x14, 0x10, 0x10, 0xff, 0x10, 0xff, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0x10, 0x10, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-  0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x4a, 0x44,
-  0x4a, 0x31, 0x00, 0x00, 0x3c, 0x42, 0x7c, 0x42, 0x7c, 0x40, 0x40, 0x00,
-  0x7e, 0x42, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x3f, 0x54, 0x14, 0x14,
-  0x14, 0x14, 0x00, 0x7e, 0x42, 0x20, 0x18, 0x20, 0x42, 0x7e, 0x00, 0x00,
-  0x00, 0x3e, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x44, 0x44, 0x44, 0x7a,
-  0x40, 0x40, 0x80, 0x00, 0x33, 0x4c, 0x08, 0x08, 0x08, 0x08, 0x00, 0x7c,
-  0x10, 0x38, 0x44, 0x44, 0x38, 0x10, 0x7c, 0x18, 0x24, 0x42, 0x7e, 0x42,
-  0x24, 0x18, 0x00, 0x18, 0x24, 0x42, 0x42, 0x24, 0x24, 0x66, 0x00, 0x1c,
-  0x20, 0x18, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x62, 0x95, 0x89, 0x95,
-  0x62, 0x00, 0x00, 0x02, 0x04, 0x3c, 0x4a, 0x52, 0x3c, 0x40, 0x80, 0x0c,
-  0x10, 0x20, 0x3c, 0x20, 0x10, 0x0c, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42,
-  0x42, 0x42, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x10,
-  0x10, 0x7c, 0x10, 0x10, 0x00, 0x7c, 0x00, 0x10, 0x08, 0x04, 0x08, 0x10,
-  0x00, 0x7e, 0x00, 0x08, 0x10, 0x20, 0x10, 0x08, 0x00, 0x7e, 0x00, 0x0c,
-  0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-  0x90, 0x90, 0x60, 0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00, 0x00,
-  0x32, 0x4c, 0x00, 0x32, 0x4c, 0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x08,
-  0xc8, 0x28, 0x18, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x30,
-  0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c,
-  0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x3c, 0x04, 0x00,
+  0xf0, 0x0d, 0x03, 0x00, 0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x0c, 0x0d, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0x56, 0x04, 0x00, 0xf0, 0x07, 0x09, 0x00,
+  0xf0, 0x0c, 0x09, 0x00, 0xf0, 0x10, 0x09, 0x00, 0xf0, 0xfa, 0x0a, 0x00,
+  0xf0, 0xff, 0x0a, 0x00, 0xf0, 0x42, 0x0b, 0x00, 0xf0, 0xc7, 0x0b, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0xd4, 0x0b, 0x00, 0xf0, 0xd7, 0x0b, 0x00,
+  0xf0, 0x0c, 0x0d, 0x00, 0xf0, 0xca, 0x0c, 0x00, 0xf0, 0x0c, 0x0d, 0x00,
+  0xf0, 0xcb, 0x0c, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e, 0x7e, 0xff, 0xdb,
+  0xff, 0xc3, 0xe7, 0xff, 0x7e, 0x6c, 0xfe, 0xfe, 0xfe, 0x7c, 0x38, 0x10,
+  0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x38, 0x7c, 0x38,
+  0xfe, 0xfe, 0xd6, 0x10, 0x38, 0x10, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x10,
+  0x38, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0xff, 0xff, 0xe7,
+  0xc3, 0xc3, 0xe7, 0xff, 0xff, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c,
+  0x00, 0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff, 0x0f, 0x03, 0x05,
+  0x7d, 0x84, 0x84, 0x84, 0x78, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x18, 0x7e,
+  0x18, 0x3f, 0x21, 0x3f, 0x20, 0x20, 0x60, 0xe0, 0xc0, 0x3f, 0x21, 0x3f,
+  0x21, 0x23, 0x67, 0xe6, 0xc0, 0x18, 0xdb, 0x3c, 0xe7, 0xe7, 0x3c, 0xdb,
+  0x18, 0x80, 0xe0, 0xf8, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 0x02, 0x0e, 0x3e,
+  0xfe, 0x3e, 0x0e, 0x02, 0x00, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c,
+  0x18, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x24, 0x00, 0x7f, 0x92, 0x92,
+  0x72, 0x12, 0x12, 0x12, 0x00, 0x3e, 0x63, 0x38, 0x44, 0x44, 0x38, 0xcc,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x18, 0x3c, 0x7e,
+  0x18, 0x7e, 0x3c, 0x18, 0xff, 0x10, 0x38, 0x7c, 0x54, 0x10, 0x10, 0x10,
+  0x00, 0x10, 0x10, 0x10, 0x54, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x18, 0x0c,
+  0xfe, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x30, 0x60, 0xfe, 0x60, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x7e, 0x00, 0x00, 0x00, 0x24, 0x66,
+  0xff, 0x66, 0x24, 0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0xfe, 0x00,
+  0x00, 0x00, 0xfe, 0xfe, 0x7c, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x38, 0x10, 0x10, 0x00, 0x10,
+  0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x7e,
+  0x24, 0x7e, 0x24, 0x24, 0x00, 0x18, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x18,
+  0x00, 0x00, 0x62, 0x64, 0x08, 0x10, 0x26, 0x46, 0x00, 0x30, 0x48, 0x30,
+  0x56, 0x88, 0x88, 0x76, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00, 0x20, 0x10, 0x08,
+  0x08, 0x08, 0x10, 0x20, 0x00, 0x00, 0x44, 0x38, 0xfe, 0x38, 0x44, 0x00,
+  0x00, 0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x02, 0x04,
+  0x08, 0x10, 0x20, 0x40, 0x00, 0x3c, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x3c,
+  0x00, 0x10, 0x30, 0x50, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x3c, 0x42, 0x02,
+  0x0c, 0x30, 0x42, 0x7e, 0x00, 0x3c, 0x42, 0x02, 0x1c, 0x02, 0x42, 0x3c,
+  0x00, 0x08, 0x18, 0x28, 0x48, 0xfe, 0x08, 0x1c, 0x00, 0x7e, 0x40, 0x7c,
+  0x02, 0x02, 0x42, 0x3c, 0x00, 0x1c, 0x20, 0x40, 0x7c, 0x42, 0x42, 0x3c,
+  0x00, 0x7e, 0x42, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00, 0x3c, 0x42, 0x42,
+  0x3c, 0x42, 0x42, 0x3c, 0x00, 0x3c, 0x42, 0x42, 0x3e, 0x02, 0x04, 0x38,
+  0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x10, 0x10, 0x20, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08,
+  0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x10, 0x08, 0x04,
+  0x02, 0x04, 0x08, 0x10, 0x00, 0x3c, 0x42, 0x02, 0x04, 0x08, 0x00, 0x08,
+  0x00, 0x3c, 0x42, 0x5e, 0x52, 0x5e, 0x40, 0x3c, 0x00, 0x18, 0x24, 0x42,
+  0x42, 0x7e, 0x42, 0x42, 0x00, 0x7c, 0x22, 0x22, 0x3c, 0x22, 0x22, 0x7c,
+  0x00, 0x1c, 0x22, 0x40, 0x40, 0x40, 0x22, 0x1c, 0x00, 0x78, 0x24, 0x22,
+  0x22, 0x22, 0x24, 0x78, 0x00, 0x7e, 0x22, 0x28, 0x38, 0x28, 0x22, 0x7e,
+  0x00, 0x7e, 0x22, 0x28, 0x38, 0x28, 0x20, 0x70, 0x00, 0x1c, 0x22, 0x40,
+  0x40, 0x4e, 0x22, 0x1e, 0x00, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42,
+  0x00, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x0e, 0x04, 0x04,
+  0x04, 0x44, 0x44, 0x38, 0x00, 0x62, 0x24, 0x28, 0x30, 0x28, 0x24, 0x63,
+  0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x22, 0x7e, 0x00, 0x63, 0x55, 0x49,
+  0x41, 0x41, 0x41, 0x41, 0x00, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x42,
+  0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00, 0x7c, 0x22, 0x22,
+  0x3c, 0x20, 0x20, 0x70, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x4a, 0x3c, 0x03,
+  0x00, 0x7c, 0x22, 0x22, 0x3c, 0x28, 0x24, 0x72, 0x00, 0x3c, 0x42, 0x40,
+  0x3c, 0x02, 0x42, 0x3c, 0x00, 0x7f, 0x49, 0x08, 0x08, 0x08, 0x08, 0x1c,
+  0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x41, 0x41, 0x41,
+  0x41, 0x22, 0x14, 0x08, 0x00, 0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x36,
+  0x00, 0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, 0x00, 0x41, 0x22, 0x14,
+  0x08, 0x08, 0x08, 0x1c, 0x00, 0x7f, 0x42, 0x04, 0x08, 0x10, 0x21, 0x7f,
+  0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00, 0x80, 0x40, 0x20,
+  0x10, 0x08, 0x04, 0x02, 0x00, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78,
+  0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0x02, 0x3e, 0x42, 0x3f, 0x00, 0x60, 0x20, 0x20,
+  0x2e, 0x31, 0x31, 0x2e, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x42, 0x3c,
+  0x00, 0x06, 0x02, 0x02, 0x3a, 0x46, 0x46, 0x3b, 0x00, 0x00, 0x00, 0x3c,
+  0x42, 0x7e, 0x40, 0x3c, 0x00, 0x0c, 0x12, 0x10, 0x38, 0x10, 0x10, 0x38,
+  0x00, 0x00, 0x00, 0x3d, 0x42, 0x42, 0x3e, 0x02, 0x7c, 0x60, 0x20, 0x2c,
+  0x32, 0x22, 0x22, 0x62, 0x00, 0x10, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38,
+  0x00, 0x02, 0x00, 0x06, 0x02, 0x02, 0x42, 0x42, 0x3c, 0x60, 0x20, 0x24,
+  0x28, 0x30, 0x28, 0x26, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38,
+  0x00, 0x00, 0x00, 0x76, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x5c,
+  0x62, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c,
+  0x00, 0x00, 0x00, 0x6c, 0x32, 0x32, 0x2c, 0x20, 0x70, 0x00, 0x00, 0x36,
+  0x4c, 0x4c, 0x34, 0x04, 0x0e, 0x00, 0x00, 0x6c, 0x32, 0x22, 0x20, 0x70,
+  0x00, 0x00, 0x00, 0x3e, 0x40, 0x3c, 0x02, 0x7c, 0x00, 0x10, 0x10, 0x7c,
+  0x10, 0x10, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x46, 0x3a,
+  0x00, 0x00, 0x00, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, 0x41,
+  0x49, 0x49, 0x49, 0x36, 0x00, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44,
+  0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x7c, 0x00, 0x00, 0x7c,
+  0x08, 0x10, 0x20, 0x7c, 0x00, 0x0c, 0x10, 0x10, 0x60, 0x10, 0x10, 0x0c,
+  0x00, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x00, 0x30, 0x08, 0x08,
+  0x06, 0x08, 0x08, 0x30, 0x00, 0x32, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x14, 0x22, 0x41, 0x41, 0x7f, 0x00, 0x3c, 0x42, 0x40,
+  0x42, 0x3c, 0x0c, 0x02, 0x3c, 0x00, 0x44, 0x00, 0x44, 0x44, 0x44, 0x3e,
+  0x00, 0x0c, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00, 0x3c, 0x42, 0x38,
+  0x04, 0x3c, 0x44, 0x3e, 0x00, 0x42, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e,
+  0x00, 0x30, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00, 0x10, 0x00, 0x38,
+  0x04, 0x3c, 0x44, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x3c, 0x06,
+  0x1c, 0x3c, 0x42, 0x3c, 0x42, 0x7e, 0x40, 0x3c, 0x00, 0x42, 0x00, 0x3c,
+  0x42, 0x7e, 0x40, 0x3c, 0x00, 0x30, 0x00, 0x3c, 0x42, 0x7e, 0x40, 0x3c,
+  0x00, 0x24, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x7c, 0x82, 0x30,
+  0x10, 0x10, 0x10, 0x38, 0x00, 0x30, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1c,
+  0x00, 0x42, 0x18, 0x24, 0x42, 0x7e, 0x42, 0x42, 0x00, 0x18, 0x18, 0x00,
+  0x3c, 0x42, 0x7e, 0x42, 0x00, 0x0c, 0x00, 0x7c, 0x20, 0x38, 0x20, 0x7c,
+  0x00, 0x00, 0x00, 0x33, 0x0c, 0x3f, 0x44, 0x3b, 0x00, 0x1f, 0x24, 0x44,
+  0x7f, 0x44, 0x44, 0x47, 0x00, 0x18, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x3c,
+  0x00, 0x00, 0x42, 0x00, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x20, 0x10, 0x00,
+  0x3c, 0x42, 0x42, 0x3c, 0x00, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x3c,
+  0x00, 0x20, 0x10, 0x00, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x42, 0x00,
+  0x42, 0x42, 0x3e, 0x02, 0x3c, 0x42, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18,
+  0x00, 0x42, 0x00, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x08, 0x08, 0x3e,
+  0x40, 0x40, 0x3e, 0x08, 0x08, 0x18, 0x24, 0x20, 0x70, 0x20, 0x42, 0x7c,
+  0x00, 0x44, 0x28, 0x7c, 0x10, 0x7c, 0x10, 0x10, 0x00, 0xf8, 0x4c, 0x78,
+  0x44, 0x4f, 0x44, 0x45, 0xe6, 0x1c, 0x12, 0x10, 0x7c, 0x10, 0x10, 0x90,
+  0x60, 0x0c, 0x00, 0x38, 0x04, 0x3c, 0x44, 0x3e, 0x00, 0x0c, 0x00, 0x18,
+  0x08, 0x08, 0x08, 0x1c, 0x00, 0x04, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x3c,
+  0x00, 0x00, 0x04, 0x08, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x32, 0x4c, 0x00,
+  0x7c, 0x42, 0x42, 0x42, 0x00, 0x34, 0x4c, 0x00, 0x62, 0x52, 0x4a, 0x46,
+  0x00, 0x3c, 0x44, 0x44, 0x3e, 0x00, 0x7e, 0x00, 0x00, 0x38, 0x44, 0x44,
+  0x38, 0x00, 0x7c, 0x00, 0x00, 0x10, 0x00, 0x10, 0x20, 0x40, 0x42, 0x3c,
+  0x00, 0x00, 0x00, 0x00, 0x7e, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x02, 0x02, 0x00, 0x00, 0x42, 0xc4, 0x48, 0xf6, 0x29, 0x43, 0x8c,
+  0x1f, 0x42, 0xc4, 0x4a, 0xf6, 0x2a, 0x5f, 0x82, 0x02, 0x00, 0x10, 0x00,
+  0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x12, 0x24, 0x48, 0x24, 0x12, 0x00,
+  0x00, 0x00, 0x48, 0x24, 0x12, 0x24, 0x48, 0x00, 0x00, 0x22, 0x88, 0x22,
+  0x88, 0x22, 0x88, 0x22, 0x88, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14,
+  0x14, 0xf4, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x14, 0x14,
+  0x14, 0x00, 0x00, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10, 0x14, 0x14, 0xf4,
+  0x04, 0xf4, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x00, 0x00, 0xfc, 0x04, 0xf4, 0x14, 0x14, 0x14, 0x14, 0x14, 0xf4,
+  0x04, 0xfc, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14, 0xfc, 0x00, 0x00,
+  0x00, 0x10, 0x10, 0xf0, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf0, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00,
+  0x00, 0x10, 0x10, 0x10, 0x10, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x10,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10,
+  0x10, 0xff, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x10,
+  0x10, 0x14, 0x14, 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x14, 0x14, 0x17,
+  0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x17, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xf7, 0x14, 0x14, 0x14, 0x14, 0x14, 0x17, 0x10, 0x17, 0x14, 0x14,
+  0x14, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x14, 0x14, 0xf7,
+  0x00, 0xf7, 0x14, 0x14, 0x14, 0x10, 0x10, 0xff, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x14, 0x14, 0x14, 0x14, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xff, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f,
+  0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x10,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0xff, 0x14, 0x14, 0x14, 0x10, 0x10, 0xff, 0x10, 0xff, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x10, 0x10, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0,
+  0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0x4a, 0x44, 0x4a, 0x31, 0x00, 0x00, 0x3c, 0x42, 0x7c, 0x42, 0x7c, 0x40,
+  0x40, 0x00, 0x7e, 0x42, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x3f, 0x54,
+  0x14, 0x14, 0x14, 0x14, 0x00, 0x7e, 0x42, 0x20, 0x18, 0x20, 0x42, 0x7e,
+  0x00, 0x00, 0x00, 0x3e, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x44, 0x44,
+  0x44, 0x7a, 0x40, 0x40, 0x80, 0x00, 0x33, 0x4c, 0x08, 0x08, 0x08, 0x08,
+  0x00, 0x7c, 0x10, 0x38, 0x44, 0x44, 0x38, 0x10, 0x7c, 0x18, 0x24, 0x42,
+  0x7e, 0x42, 0x24, 0x18, 0x00, 0x18, 0x24, 0x42, 0x42, 0x24, 0x24, 0x66,
+  0x00, 0x1c, 0x20, 0x18, 0x3c, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x62, 0x95,
+  0x89, 0x95, 0x62, 0x00, 0x00, 0x02, 0x04, 0x3c, 0x4a, 0x52, 0x3c, 0x40,
+  0x80, 0x0c, 0x10, 0x20, 0x3c, 0x20, 0x10, 0x0c, 0x00, 0x3c, 0x42, 0x42,
+  0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00,
+  0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00, 0x7c, 0x00, 0x10, 0x08, 0x04,
+  0x08, 0x10, 0x00, 0x7e, 0x00, 0x08, 0x10, 0x20, 0x10, 0x08, 0x00, 0x7e,
+  0x00, 0x0c, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x90, 0x90, 0x60, 0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18,
+  0x00, 0x00, 0x32, 0x4c, 0x00, 0x32, 0x4c, 0x00, 0x00, 0x30, 0x48, 0x48,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08,
+  0x08, 0x08, 0xc8, 0x28, 0x18, 0x78, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+  0x00, 0x30, 0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00
 };
-unsigned int bios_bin_len = 5905;
+unsigned int bios_bin_len = 5797;
@@ -7,7 +7,6 @@
 #include "kb.h"
 #include "version.h"
 
-#include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -16,6 +15,12 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
 #if defined(_WIN32) && !defined(__MINGW32__)
 	#include <SDL.h>
 #else
@@ -34,7 +39,7 @@
 	#include <nfd.h>
 
 	// TODO: Clean this up. See OSX dialogs.
-	static void open_window(void *ud, vxt_mode_t m, int x, int y);
+	static void open_window(vxt_mode_t m, int x, int y);
 #else
 	#include <unistd.h>
 #endif
@@ -49,7 +54,6 @@
 
 vxt_emulator_t *e = 0;
 vxt_drive_t fd = {0};
-vxt_key_t auto_release = {0};
 int command_key = 0;
 
 const int text_color[] = {
@@ -76,11 +80,30 @@ const char *video_driver = "opengl";
 
 char title_buffer[64] = {0};
 SDL_Window *sdl_window = 0;
-SDL_Surface *sdl_surface = 0;
 SDL_Texture *sdl_texture = 0;
 SDL_Renderer *sdl_renderer = 0;
 SDL_AudioSpec sdl_audio = {44100, AUDIO_U8, 1, 0, 128};
 
+// Text mode keeps what each cell shows, so only cells that changed or blink are redrawn. glyph_mask expands a row of
+// font bits to eight pixel masks.
+unsigned glyph_mask[256][8];
+unsigned text_shadow[80*25];
+
+// The emulator runs on its own thread. Graphics modes draw into canvas and finished rows are copied to frame under
+// handover_lock, while text cells are drawn straight into frame under the lock. The main thread, which owns the window,
+// copies the rows from frame into the texture and presents them. Rows
+// frame_y0 to frame_y1 of frame are waiting to be taken, and frame_seen lags frame_seq until the main thread has caught
+// up with a mode change. Keys, floppy swaps and the title are handed over under the same lock.
+#define KEY_QUEUE_SIZE 64
+SDL_mutex *handover_lock = 0;
+SDL_cond *frame_ready = 0;
+SDL_atomic_t quit = {0};
+byte *canvas = 0, *frame = 0;
+vxt_mode_t frame_mode = VXT_TEXT;
+int frame_w = 0, frame_h = 0, frame_pitch = 0, frame_y0 = 0, frame_y1 = 0, frame_seq = 0, frame_seen = 0, title_seq = 0;
+vxt_key_t key_queue[KEY_QUEUE_SIZE];
+int key_head = 0, key_tail = 0, floppy_request = -1;
+
 static void replace_floppy()
 {
 	int f = -1;
@@ -100,7 +123,7 @@ static void replace_floppy()
 	#elif defined(__APPLE__) && defined(__MACH__)
 
 		// TODO: This is a hack since dialogs won't work without a window.
-		if (!sdl_window) open_window(0, VXT_TEXT, 640, 200);
+		if (!sdl_window) open_window(VXT_TEXT, 640, 200);
 
 		nfdchar_t *path = 0;
 		if (NFD_OpenDialog("img", 0, &path) != NFD_OKAY) return;
@@ -127,9 +150,26 @@ static void replace_floppy()
 		return;
 	}
 
-	if (fd.userdata) close((int)(intptr_t)fd.userdata);
-	fd.userdata = (void*)(intptr_t)f;
-	vxt_replace_floppy(e, &fd);
+	// The emulator thread inserts the new floppy between batches
+	SDL_LockMutex(handover_lock);
+	if (floppy_request != -1) close(floppy_request);
+	floppy_request = f;
+	SDL_UnlockMutex(handover_lock);
+}
+
+// Called on the emulator thread before each batch
+static void insert_floppy()
+{
+	SDL_LockMutex(handover_lock);
+	int f = floppy_request;
+	floppy_request = -1;
+	SDL_UnlockMutex(handover_lock);
+
+	if (f != -1) {
+		if (fd.userdata) close((int)(intptr_t)fd.userdata);
+		fd.userdata = (void*)(intptr_t)f;
+		vxt_replace_floppy(e, &fd);
+	}
 }
 
 static int file_exist(const char *filename)
@@ -140,16 +180,15 @@ static int file_exist(const char *filename)
 
 static void close_window()
 {
-	SDL_FreeSurface(sdl_surface); sdl_surface = 0;
 	SDL_DestroyTexture(sdl_texture); sdl_texture = 0;
 	SDL_DestroyRenderer(sdl_renderer); sdl_renderer = 0;
 	SDL_DestroyWindow(sdl_window); sdl_window = 0;
 }
 
-static void open_window(void *ud, vxt_mode_t m, int x, int y)
+// Create the window, or a new texture for a mode change. Main thread only.
+static void open_window(vxt_mode_t m, int x, int y)
 {
 	if (sdl_window) {
-		SDL_FreeSurface(sdl_surface); sdl_surface = 0;
 		SDL_DestroyTexture(sdl_texture); sdl_texture = 0;
 	} else {
 		SDL_SetHint(SDL_HINT_WINDOWS_NO_CLOSE_ON_ALT_F4, "1");
@@ -168,22 +207,89 @@ static void open_window(void *ud, vxt_mode_t m, int x, int y)
 	SDL_SetWindowTitle(sdl_window, "VirtualXT");
 	SDL_StartTextInput();
 
-	if (m == VXT_TEXT) {
-		sdl_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_RGB888, SDL_TEXTUREACCESS_STREAMING, x, y);	
-		sdl_surface = SDL_CreateRGBSurface(0, x, y, 32, 0, 0, 0, 0);
+	sdl_texture = SDL_CreateTexture(sdl_renderer, m == VXT_TEXT ? SDL_PIXELFORMAT_RGB888 : SDL_PIXELFORMAT_RGB332, SDL_TEXTUREACCESS_STREAMING, x, y);
+}
+
+// Video mode change, called on the emulator thread. The main thread opens the window or replaces the texture when
+// it takes the next frame.
+static void set_mode(void *ud, vxt_mode_t m, int x, int y)
+{
+	SDL_LockMutex(handover_lock);
+	frame_mode = m; frame_w = x; frame_h = y;
+	frame_pitch = x * (m == VXT_TEXT ? 4 : 1);
+	frame = (byte*)realloc(frame, frame_pitch * y);
+	if (m != VXT_TEXT) {
+		canvas = (byte*)realloc(canvas, frame_pitch * y);
+		memset(canvas, 0, frame_pitch * y);
+	}
+	frame_y0 = 0; frame_y1 = 0;
+	frame_seq++;
+	SDL_UnlockMutex(handover_lock);
+
+	memset(text_shadow, 0xFF, sizeof(text_shadow));
+}
+
+// Add rows y0 to y1 of frame to the ones waiting for the main thread. Called with the handover lock held.
+static void mark_rows(int y0, int y1)
+{
+	if (y0 >= y1)
+		return;
+
+	if (frame_y1 > frame_y0) {
+		frame_y0 = y0 < frame_y0 ? y0 : frame_y0;
+		frame_y1 = y1 > frame_y1 ? y1 : frame_y1;
 	} else {
-		sdl_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_RGB332, SDL_TEXTUREACCESS_STREAMING, x, y);	
-		sdl_surface = SDL_CreateRGBSurface(0, x, y, 8, 0xE0, 0x1C, 0x3, 0x0);
+		frame_y0 = y0; frame_y1 = y1;
 	}
+	SDL_CondSignal(frame_ready);
+}
+
+// Hand rows y0 to y1 of the canvas over to the main thread. Only the copy is done under the lock, so the emulator
+// never waits for the GPU.
+static void publish(int y0, int y1)
+{
+	if (y0 >= y1)
+		return;
+
+	SDL_LockMutex(handover_lock);
+	memcpy(frame + y0 * frame_pitch, canvas + y0 * frame_pitch, (y1 - y0) * frame_pitch);
+	mark_rows(y0, y1);
+	SDL_UnlockMutex(handover_lock);
 }
 
+// The emulator writes the changed scanlines of a frame after this returns, so asking for the buffer again means the
+// previous frame is complete
 static byte *video_buffer(void *ud)
 {
+	publish(0, frame_h);
+	return canvas;
+}
+
+// Write the rows finished since the last call into the texture and present. The rows are copied straight from frame
+// while the handover lock is held. Main thread only.
+static void present(int redraw)
+{
+	SDL_LockMutex(handover_lock);
+	if (frame_seen != frame_seq)
+		frame_seen = frame_seq, open_window(frame_mode, frame_w, frame_h);
+
+	int y0 = frame_y0, y1 = frame_y1, pitch;
+	void *pixels;
+	SDL_Rect rect = {0, y0, frame_w, y1 - y0};
+	if (y1 > y0 && sdl_texture && !SDL_LockTexture(sdl_texture, &rect, &pixels, &pitch)) {
+		for (int y = y0; y < y1; y++)
+			memcpy((byte*)pixels + (y - y0) * pitch, frame + y * frame_pitch, frame_pitch);
+		SDL_UnlockTexture(sdl_texture);
+	}
+	frame_y0 = frame_y1 = 0;
+	SDL_UnlockMutex(handover_lock);
+
+	if (!sdl_texture || (y1 <= y0 && !redraw))
+		return;
+
 	SDL_RenderClear(sdl_renderer);
-	SDL_UpdateTexture(sdl_texture, 0, sdl_surface->pixels, sdl_surface->pitch);
 	SDL_RenderCopy(sdl_renderer, sdl_texture, 0, 0);
 	SDL_RenderPresent(sdl_renderer);
-	return sdl_surface->pixels;
 }
 
 static size_t io_read(void *ud, void* buf, size_t count) { return (size_t)read((int)(intptr_t)ud, buf, count); }
@@ -193,43 +299,69 @@ static size_t io_seek(void *ud, size_t offset, int whence) { return (size_t)lsee
 static struct tm *get_localtime(void *ud) { time((time_t*)ud); return localtime((time_t*)ud); }
 static unsigned short get_millitm(void *ud) { struct timeb c; ftime(&c); return c.millitm; }
 
-static void quit_sdl() { if (sdl_window) close_window(); SDL_Quit(); }
+static void quit_sdl() { if (sdl_window) close_window(); SDL_Quit(); free(canvas); free(frame); }
 static void close_emulator() { if (e) vxt_close(e); }
 
-static void blit_char(SDL_Surface *dst, byte *font, byte ch, byte attrib, int x, int y)
+// Draw the eight pixel rows of a cell, foreground where the font bit is set and background elsewhere
+static void draw_cell(byte *dst, int pitch, const byte *glyph, unsigned fg, unsigned bg)
 {
-	assert(dst->format->BytesPerPixel == 4);
-
-	unsigned *pixels = (unsigned*)dst->pixels;
-	unsigned bgcolor = text_color[(attrib&0x70)>>4];
-	unsigned fgcolor = ((attrib&0x80) && vxt_blink(e)) ? bgcolor : text_color[attrib&0xF];
-	
-	for (int i = 0; i < 8; i++) {
-		unsigned char glyph_line = font[ch*8+i];
-
-		for (int j = 0; j < 8; j++) {
-			unsigned char mask = 0x80 >> j;
-			unsigned fg = (glyph_line & mask ? fgcolor : bgcolor);
-			pixels[dst->w * (y + i) + x + j] = fg | 0xFF000000;
-		}
+#if defined(__AVX2__)
+	__m256i fgv = _mm256_set1_epi32((int)fg), bgv = _mm256_set1_epi32((int)bg);
+#elif defined(__SSE2__)
+	__m128i fgv = _mm_set1_epi32((int)fg), bgv = _mm_set1_epi32((int)bg);
+#endif
+
+	for (int i = 0; i < 8; i++, dst += pitch) {
+		const unsigned *mask = glyph_mask[glyph[i]];
+	#if defined(__AVX2__)
+		__m256i m = _mm256_loadu_si256((const __m256i*)mask);
+		_mm256_storeu_si256((__m256i*)dst, _mm256_or_si256(_mm256_and_si256(m, fgv), _mm256_andnot_si256(m, bgv)));
+	#elif defined(__SSE2__)
+		__m128i lo = _mm_loadu_si128((const __m128i*)mask), hi = _mm_loadu_si128((const __m128i*)(mask + 4));
+		_mm_storeu_si128((__m128i*)dst, _mm_or_si128(_mm_and_si128(lo, fgv), _mm_andnot_si128(lo, bgv)));
+		_mm_storeu_si128((__m128i*)dst + 1, _mm_or_si128(_mm_and_si128(hi, fgv), _mm_andnot_si128(hi, bgv)));
+	#else
+		for (int j = 0; j < 8; j++)
+			((unsigned*)dst)[j] = bg ^ ((fg ^ bg) & mask[j]);
+	#endif
 	}
 }
 
-static void textmode(unsigned char *mem, byte *font, byte cursor, byte cx, byte cy)
+// What a cell shows: character in the low byte, then foreground and background colour. The cursor replaces the
+// character with an underscore while it is blinked on.
+static unsigned cell_key(unsigned char *mem, int index, int cursor_cell, int blink)
 {
-	const int nchar = 80*25;
-	for (int i = 0; i < nchar * 2; i+=2) {
-		unsigned char ch = mem[i];
-		int index = i / 2;
-		blit_char(sdl_surface, font, ch, mem[i+1], (index % 80) * 8, (index / 80) * 8);
-	}
-
-	if (cursor && vxt_blink(e))
-		blit_char(sdl_surface, font, '_', (mem[160*cy+cx*2+1] & 0x70) | 0xF, cx * 8, cy * 8);
+	byte ch = cursor_cell ? '_' : mem[index*2], attrib = cursor_cell ? (mem[index*2+1] & 0x70) | 0xF : mem[index*2+1];
+	unsigned bg = (attrib & 0x70) >> 4, fg = ((attrib & 0x80) && blink) ? bg : attrib & 0xF;
+	return ch | fg << 8 | bg << 12;
+}
 
-	SDL_UpdateTexture(sdl_texture, 0, sdl_surface->pixels, sdl_surface->pitch);
-	SDL_RenderCopy(sdl_renderer, sdl_texture, 0, 0);
-	SDL_RenderPresent(sdl_renderer);
+static void textmode(unsigned char *mem, byte *font, byte cursor, byte cx, byte cy, unsigned rows)
+{
+	int blink = vxt_blink(e), cursor_index = (cursor && blink) ? cy * 80 + cx : -1, y0 = 200, y1 = 0;
+	SDL_LockMutex(handover_lock);
+	for (int y = 0; y < 25; y++) {
+		if (!(rows & (1 << y)))
+			continue;
+
+		unsigned keys[80];
+		for (int x = 0; x < 80; x++)
+			keys[x] = cell_key(mem, y * 80 + x, y * 80 + x == cursor_index, blink);
+
+		// Draw the changed cells straight into the frame the main thread copies into the texture
+		unsigned *shadow = text_shadow + y * 80;
+		for (int x = 0; x < 80; x++) {
+			if (keys[x] == shadow[x])
+				continue;
+
+			draw_cell(frame + y * 8 * frame_pitch + x * 32, frame_pitch, font + (keys[x] & 0xFF) * 8, text_color[keys[x] >> 8 & 0xF] | 0xFF000000, text_color[keys[x] >> 12] | 0xFF000000);
+			shadow[x] = keys[x];
+			y0 = y0 < y * 8 ? y0 : y * 8;
+			y1 = y * 8 + 8;
+		}
+	}
+	mark_rows(y0, y1);
+	SDL_UnlockMutex(handover_lock);
 }
 
 byte joystick_buttons(void *ud)
@@ -276,127 +408,215 @@ static void open_manual()
 		printf("Could not find the manual!\n");
 }
 
-static vxt_key_t sdl_getkey(void *ud)
+// Translate an SDL event to a key for the guest, or handle it as a command. Main thread only.
+static vxt_key_t translate_event(SDL_Event *ev)
 {
-	vxt_key_t key = {.scancode = VXT_KEY_INVALID, .ascii = 0};
-	if (auto_release.scancode != VXT_KEY_INVALID)
+	const vxt_key_t none = {.scancode = VXT_KEY_INVALID, .ascii = 0};
+	vxt_key_t key = none;
+
+	if (ev->type == SDL_QUIT)
+		SDL_AtomicSet(&quit, 1);
+
+	if (ev->type == SDL_TEXTINPUT)
 	{
-		key = auto_release;
-		auto_release.scancode = VXT_KEY_INVALID; auto_release.ascii = 0;
+		char ch = *ev->text.text;
+		key.scancode = ascii2scan[ch - 0x20];
+		key.ascii = *ev->text.text;
+
+		// Reset any buffers.
+		// Not sure we should do this. /aj
+		SDL_StopTextInput();
+		SDL_StartTextInput();
 		return key;
 	}
-	
-	if (sdl_window)
-	{
-		SDL_Event ev;
-		while (SDL_PollEvent(&ev))
-		{
-			key.ascii = 0;
-			key.scancode = VXT_KEY_INVALID;
 
-            if (ev.type == SDL_QUIT)
-				exit(0);
-
-			if (ev.type == SDL_TEXTINPUT)
-			{
-				char ch = *ev.text.text;
-				key.scancode = ascii2scan[ch - 0x20];
-				key.ascii = *ev.text.text;
-
-				auto_release = key;
-				auto_release.scancode |= VXT_MASK_KEY_UP;
+	if (ev->type == SDL_KEYDOWN) key.scancode = VXT_KEY_INVALID;
+	else if (ev->type == SDL_KEYUP) key.scancode = VXT_MASK_KEY_UP;
+	else return none;
+
+	SDL_Keycode sym = ev->key.keysym.sym;
+	if ((ev->key.keysym.mod & KMOD_NUM) == 0) switch (sym)
+    {
+        case SDLK_KP_0: key.scancode |= VXT_KEY_KP_INSERT_0; return key;
+		case SDLK_KP_1: key.scancode |= VXT_KEY_KP_END_1; return key;
+		case SDLK_KP_2: key.scancode |= VXT_KEY_KP_DOWN_2; return key;
+		case SDLK_KP_3: key.scancode |= VXT_KEY_KP_PAGEDOWN_3; return key;
+		case SDLK_KP_4: key.scancode |= VXT_KEY_KP_LEFT_4; return key;
+		case SDLK_KP_6: key.scancode |= VXT_KEY_KP_RIGHT_6; return key;
+		case SDLK_KP_7: key.scancode |= VXT_KEY_KP_HOME_7; return key;
+		case SDLK_KP_8: key.scancode |= VXT_KEY_KP_UP_8; return key;
+        case SDLK_KP_9: key.scancode |= VXT_KEY_KP_PAGEUP_9; return key;
+	}
 
-				// Reset any buffers.
-				// Not sure we should do this. /aj
-				SDL_StopTextInput();
+    switch (sym)
+    {
+        case SDLK_ESCAPE: key.ascii = 0x1B; key.scancode |= VXT_KEY_ESCAPE; return key;
+        case SDLK_RETURN: key.ascii = '\r'; key.scancode |= VXT_KEY_ENTER; return key;
+        case SDLK_BACKSPACE: key.ascii = '\b'; key.scancode |= VXT_KEY_BACKSPACE; return key;
+        case SDLK_TAB: key.ascii = '\t'; key.scancode |= VXT_KEY_TAB; return key;
+        case SDLK_LCTRL: case SDLK_RCTRL: key.scancode |= VXT_KEY_CONTROL; return key;
+        case SDLK_LALT: key.scancode |= VXT_KEY_ALT; return key;
+        case SDLK_NUMLOCKCLEAR: key.scancode |= VXT_KEY_NUMLOCK; return key;
+        case SDLK_SCROLLLOCK: key.scancode |= VXT_KEY_SCROLLOCK; return key;
+		case SDLK_CAPSLOCK: key.scancode |= VXT_KEY_CAPSLOCK; return key;
+		case SDLK_LSHIFT: key.scancode |= VXT_KEY_LSHIFT; return key;
+        case SDLK_RSHIFT: key.scancode |= VXT_KEY_RSHIFT; return key;
+        case SDLK_PRINTSCREEN: key.scancode |= VXT_KEY_PRINT; return key;
+
+		case SDLK_DELETE: key.scancode |= VXT_KEY_KP_DELETE_PERIOD; return key;
+        case SDLK_INSERT: key.scancode |= VXT_KEY_KP_INSERT_0; return key;
+		case SDLK_END: key.scancode |= VXT_KEY_KP_END_1; return key;
+		case SDLK_DOWN: key.scancode |= VXT_KEY_KP_DOWN_2; return key;
+		case SDLK_PAGEDOWN: key.scancode |= VXT_KEY_KP_PAGEDOWN_3; return key;
+		case SDLK_LEFT: key.scancode |= VXT_KEY_KP_LEFT_4; return key;
+		case SDLK_RIGHT: key.scancode |= VXT_KEY_KP_RIGHT_6; return key;
+		case SDLK_HOME: key.scancode |= VXT_KEY_KP_HOME_7; return key;
+		case SDLK_UP: key.scancode |= VXT_KEY_KP_UP_8; return key;
+        case SDLK_PAGEUP: key.scancode |= VXT_KEY_KP_PAGEUP_9; return key;
+
+        case SDLK_F1: key.scancode |= VXT_KEY_F1; return key;
+        case SDLK_F2: key.scancode |= VXT_KEY_F2; return key;
+        case SDLK_F3: key.scancode |= VXT_KEY_F3; return key;
+        case SDLK_F4: key.scancode |= VXT_KEY_F4; return key;
+        case SDLK_F5: key.scancode |= VXT_KEY_F5; return key;
+        case SDLK_F6: key.scancode |= VXT_KEY_F6; return key;
+        case SDLK_F7: key.scancode |= VXT_KEY_F7; return key;
+        case SDLK_F8: key.scancode |= VXT_KEY_F8; return key;
+        case SDLK_F9: key.scancode |= VXT_KEY_F9; return key;
+        case SDLK_F10: key.scancode |= VXT_KEY_F10; return key;
+
+		case SDLK_F11:
+		case SDLK_F12:
+		{
+			if (ev->type == SDL_KEYDOWN) {
+				if (!ev->key.repeat) {
+					command_key = 1;
+					SDL_StopTextInput();
+				}
+			} else {
+				command_key = 0;
 				SDL_StartTextInput();
-				return key;
 			}
+			return none;
+		}
 
-			if (ev.type == SDL_KEYDOWN) key.scancode = VXT_KEY_INVALID;
-			else if (ev.type == SDL_KEYUP) key.scancode = VXT_MASK_KEY_UP;
-			else continue;
-
-			SDL_Keycode sym = ev.key.keysym.sym;
-			if ((ev.key.keysym.mod & KMOD_NUM) == 0) switch (sym)
-            {
-                case SDLK_KP_0: key.scancode |= VXT_KEY_KP_INSERT_0; return key;
-				case SDLK_KP_1: key.scancode |= VXT_KEY_KP_END_1; return key;
-				case SDLK_KP_2: key.scancode |= VXT_KEY_KP_DOWN_2; return key;
-				case SDLK_KP_3: key.scancode |= VXT_KEY_KP_PAGEDOWN_3; return key;
-				case SDLK_KP_4: key.scancode |= VXT_KEY_KP_LEFT_4; return key;
-				case SDLK_KP_6: key.scancode |= VXT_KEY_KP_RIGHT_6; return key;
-				case SDLK_KP_7: key.scancode |= VXT_KEY_KP_HOME_7; return key;
-				case SDLK_KP_8: key.scancode |= VXT_KEY_KP_UP_8; return key;
-                case SDLK_KP_9: key.scancode |= VXT_KEY_KP_PAGEUP_9; return key;
+		default:
+			if (command_key && ev->type == SDL_KEYDOWN && !ev->key.repeat) switch (sym)
+			{
+				case 'q': SDL_AtomicSet(&quit, 1); return none;
+				case 'a': replace_floppy(); return none;
+				case 'f': SDL_SetWindowFullscreen(sdl_window, SDL_GetWindowFlags(sdl_window) & (SDL_WINDOW_FULLSCREEN|SDL_WINDOW_FULLSCREEN_DESKTOP) ? 0 : SDL_WINDOW_FULLSCREEN_DESKTOP); return none;
+				case 'm': open_manual(); return none;
 			}
+	}
+	return none;
+}
 
-            switch (sym)
-            {
-                case SDLK_ESCAPE: key.ascii = 0x1B; key.scancode |= VXT_KEY_ESCAPE; return key;
-                case SDLK_RETURN: key.ascii = '\r'; key.scancode |= VXT_KEY_ENTER; return key;
-                case SDLK_BACKSPACE: key.ascii = '\b'; key.scancode |= VXT_KEY_BACKSPACE; return key;
-                case SDLK_TAB: key.ascii = '\t'; key.scancode |= VXT_KEY_TAB; return key;
-                case SDLK_LCTRL: case SDLK_RCTRL: key.scancode |= VXT_KEY_CONTROL; return key;
-                case SDLK_LALT: key.scancode |= VXT_KEY_ALT; return key;
-                case SDLK_NUMLOCKCLEAR: key.scancode |= VXT_KEY_NUMLOCK; return key;
-                case SDLK_SCROLLLOCK: key.scancode |= VXT_KEY_SCROLLOCK; return key;
-				case SDLK_CAPSLOCK: key.scancode |= VXT_KEY_CAPSLOCK; return key;
-				case SDLK_LSHIFT: key.scancode |= VXT_KEY_LSHIFT; return key;
-                case SDLK_RSHIFT: key.scancode |= VXT_KEY_RSHIFT; return key;
-                case SDLK_PRINTSCREEN: key.scancode |= VXT_KEY_PRINT; return key;
-
-				case SDLK_DELETE: key.scancode |= VXT_KEY_KP_DELETE_PERIOD; return key;
-                case SDLK_INSERT: key.scancode |= VXT_KEY_KP_INSERT_0; return key;
-				case SDLK_END: key.scancode |= VXT_KEY_KP_END_1; return key;
-				case SDLK_DOWN: key.scancode |= VXT_KEY_KP_DOWN_2; return key;
-				case SDLK_PAGEDOWN: key.scancode |= VXT_KEY_KP_PAGEDOWN_3; return key;
-				case SDLK_LEFT: key.scancode |= VXT_KEY_KP_LEFT_4; return key;
-				case SDLK_RIGHT: key.scancode |= VXT_KEY_KP_RIGHT_6; return key;
-				case SDLK_HOME: key.scancode |= VXT_KEY_KP_HOME_7; return key;
-				case SDLK_UP: key.scancode |= VXT_KEY_KP_UP_8; return key;
-                case SDLK_PAGEUP: key.scancode |= VXT_KEY_KP_PAGEUP_9; return key;
-
-                case SDLK_F1: key.scancode |= VXT_KEY_F1; return key;
-                case SDLK_F2: key.scancode |= VXT_KEY_F2; return key;
-                case SDLK_F3: key.scancode |= VXT_KEY_F3; return key;
-                case SDLK_F4: key.scancode |= VXT_KEY_F4; return key;
-                case SDLK_F5: key.scancode |= VXT_KEY_F5; return key;
-                case SDLK_F6: key.scancode |= VXT_KEY_F6; return key;
-                case SDLK_F7: key.scancode |= VXT_KEY_F7; return key;
-                case SDLK_F8: key.scancode |= VXT_KEY_F8; return key;
-                case SDLK_F9: key.scancode |= VXT_KEY_F9; return key;
-                case SDLK_F10: key.scancode |= VXT_KEY_F10; return key;
-
-				case SDLK_F11:
-				case SDLK_F12:
-				{
-					if (ev.type == SDL_KEYDOWN) {
-						if (!ev.key.repeat) {
-							command_key = 1;
-							SDL_StopTextInput();
-						}
-					} else {
-						command_key = 0;
-						SDL_StartTextInput();
-					}
-					continue;
-				}
-
-				default:
-					if (command_key && ev.type == SDL_KEYDOWN && !ev.key.repeat) switch (sym)
-					{
-						case 'q': exit(0);
-						case 'a': replace_floppy(); continue;
-						case 'f': SDL_SetWindowFullscreen(sdl_window, SDL_GetWindowFlags(sdl_window) & (SDL_WINDOW_FULLSCREEN|SDL_WINDOW_FULLSCREEN_DESKTOP) ? 0 : SDL_WINDOW_FULLSCREEN_DESKTOP); continue;
-						case 'm': open_manual(); continue;
-					}
+// Drain the SDL event queue and queue keys for the emulator thread. Text input is queued as a press and a release.
+// Returns non-zero if the window needs to be redrawn.
+static int pump_events()
+{
+	int redraw = 0;
+	SDL_Event ev;
+	while (sdl_window && SDL_PollEvent(&ev))
+	{
+		redraw |= ev.type == SDL_WINDOWEVENT;
+		vxt_key_t key = translate_event(&ev);
+		if ((key.scancode & ~VXT_MASK_KEY_UP) == VXT_KEY_INVALID)
+			continue;
+
+		SDL_LockMutex(handover_lock);
+		for (int n = ev.type == SDL_TEXTINPUT ? 2 : 1; n--; key.scancode |= VXT_MASK_KEY_UP) {
+			if ((key_tail + 1) % KEY_QUEUE_SIZE != key_head) {
+				key_queue[key_tail] = key;
+				key_tail = (key_tail + 1) % KEY_QUEUE_SIZE;
 			}
 		}
+		SDL_UnlockMutex(handover_lock);
+	}
+	return redraw;
+}
+
+static vxt_key_t sdl_getkey(void *ud)
+{
+	vxt_key_t key = {.scancode = VXT_KEY_INVALID, .ascii = 0};
+	SDL_LockMutex(handover_lock);
+	if (key_head != key_tail) {
+		key = key_queue[key_head];
+		key_head = (key_head + 1) % KEY_QUEUE_SIZE;
 	}
+	SDL_UnlockMutex(handover_lock);
 	return key;
 }
 
+// Speed profiles. A profile with a clock rate ticks the virtual clock by modelled CPU cycles and is paced against the
+// wall clock.
+static const struct {
+	const char *name;
+	vxt_cpu_t cpu;
+	unsigned hz;
+} speed_profiles[] = {
+	{"xt", VXT_CPU_8088, 4772727}, // IBM PC/XT
+	{"turbo", VXT_CPU_8088, 8000000}, // Turbo XT clone
+	{"v20", VXT_CPU_V20, 10000000},
+	{"max", VXT_CPU_8088, 0} // As fast as the host allows
+};
+
+unsigned pace_hz = 0;
+
+// Run a batch of instructions, paced against the wall clock. Returns zero when the guest has stopped.
+static int run_batch()
+{
+	static const int batch = 10000;
+	static Uint64 freq = 0, last, pace_start;
+	static unsigned long long paced_us;
+	static size_t num_inst;
+
+	if (!freq) freq = SDL_GetPerformanceFrequency(), last = pace_start = SDL_GetPerformanceCounter();
+
+	Uint64 start = SDL_GetPerformanceCounter();
+	if ((start - last) / freq >= 1) {
+		SDL_LockMutex(handover_lock);
+		sprintf(title_buffer, "VirtualXT @ %.2f MIPS", (double)num_inst / 1000000.0);
+		title_seq++;
+		SDL_UnlockMutex(handover_lock);
+		last = start;
+		num_inst = 0;
+	}
+
+	insert_floppy();
+
+	vxt_stop_t reason;
+	num_inst += vxt_run(e, batch, &reason);
+	if (reason != VXT_STOP_BUDGET && reason != VXT_STOP_IDLE)
+		return 0;
+
+	if (pace_hz) {
+		// Sleep while virtual time is ahead of the wall clock. A host that falls far behind stops trying to catch up.
+		paced_us += vxt_run_time(e);
+		double ahead = paced_us - (double)(SDL_GetPerformanceCounter() - pace_start) * 1000000.0 / freq;
+		if (ahead >= 1000.0)
+			SDL_Delay((Uint32)(ahead / 1000.0));
+		else if (ahead < -100000.0)
+			pace_start = SDL_GetPerformanceCounter(), paced_us = 0;
+	} else if (reason == VXT_STOP_IDLE) {
+		// Sleep through the virtual time the guest skipped
+		SDL_Delay(vxt_idle_time(e) / 1000);
+	}
+	return 1;
+}
+
+// Emulator thread. Wakes the main thread when the guest stops so it can quit.
+static int emulate(void *ud)
+{
+	while (!SDL_AtomicGet(&quit) && run_batch());
+	SDL_AtomicSet(&quit, 1);
+	SDL_LockMutex(handover_lock);
+	SDL_CondSignal(frame_ready);
+	SDL_UnlockMutex(handover_lock);
+	return 0;
+}
+
 static void print_help()
 {
 	printf("VirtualXT - IBM PC/XT Emulator\n");
@@ -415,7 +635,7 @@ int main(int argc, char *argv[])
 
 	int hdboot_arg = 0, noaudio_arg = 0, joystick_arg = 0, scroff_arg = 0;
 	double mips_arg = 0.0;
-	const char *fd_arg = 0, *hd_arg = 0, *bios_arg = 0;
+	const char *fd_arg = 0, *hd_arg = 0, *bios_arg = 0, *core_arg = 0, *cpu_arg = 0, *speed_arg = 0;
 
 	while (--argc && ++argv) {
 		if (PARAM("-h")) { print_help(); return 0; }
@@ -431,12 +651,21 @@ int main(int argc, char *argv[])
 		if (PARAM("--bios")) { bios_arg = argc-- ? *(++argv) : bios_arg; continue; }
 		if (PARAM("--filter")) { scale_filter = argc-- ? *(++argv) : scale_filter; continue; }
 		if (PARAM("--driver")) { video_driver = argc-- ? *(++argv) : video_driver; continue; }
+		if (PARAM("--core")) { core_arg = argc-- ? *(++argv) : core_arg; continue; }
+		if (PARAM("--cpu")) { cpu_arg = argc-- ? *(++argv) : cpu_arg; continue; }
+		if (PARAM("--speed")) { speed_arg = argc-- ? *(++argv) : speed_arg; continue; }
 		printf("Invalid parameter: %s\n", *argv); return -1;
 	}
 
 	time_t clock_buf;
 	vxt_clock_t clock = {.userdata = &clock_buf, .localtime = get_localtime, .millitm = get_millitm};
-	vxt_video_t video = {.userdata = 0, .getkey = sdl_getkey, .initialize = open_window, .backbuffer = video_buffer, .textmode = textmode};
+	handover_lock = SDL_CreateMutex();
+	frame_ready = SDL_CreateCond();
+	for (int i = 0; i < 256; i++)
+		for (int j = 0; j < 8; j++)
+			glyph_mask[i][j] = (i & (0x80 >> j)) ? 0xFFFFFFFF : 0;
+
+	vxt_video_t video = {.userdata = 0, .getkey = sdl_getkey, .initialize = set_mode, .backbuffer = video_buffer, .textmode = textmode};
 	e = vxt_open(&video, &clock, VXT_INTERNAL_MEMORY);
 	atexit(close_emulator);
 
@@ -515,30 +744,64 @@ int main(int argc, char *argv[])
 	}
 
 	vxt_set_screen(e, scroff_arg ? 0 : 1);
+	vxt_set_idle(e, 1);
+
+	if (core_arg)
+	{
+		if (!strcmp(core_arg, "block")) vxt_set_core(e, VXT_CORE_BLOCK);
+		else if (strcmp(core_arg, "interpreter")) { printf("Invalid CPU core: %s\n", core_arg); return -1; }
+	}
+
+	if (speed_arg)
+	{
+		int i = sizeof(speed_profiles) / sizeof(speed_profiles[0]);
+		while (i-- && strcmp(speed_arg, speed_profiles[i].name));
+		if (i < 0) { printf("Invalid speed profile: %s\n", speed_arg); return -1; }
+
+		vxt_set_cpu(e, speed_profiles[i].cpu);
+		if ((pace_hz = speed_profiles[i].hz))
+			vxt_set_cycle_timing(e, 1), vxt_set_frequency(e, pace_hz);
+	}
+
+	// A fixed MIPS rate counts instructions rather than cycles
+	if (mips_arg > 0.0)
+		vxt_set_cycle_timing(e, 0), vxt_set_frequency(e, pace_hz = (unsigned)(mips_arg * 1000000.0));
+
+	if (cpu_arg)
+	{
+		if (!strcmp(cpu_arg, "v20")) vxt_set_cpu(e, VXT_CPU_V20);
+		else if (strcmp(cpu_arg, "8088")) { printf("Invalid CPU: %s\n", cpu_arg); return -1; }
+	}
 
 	if (!fd_arg && !hd_arg)
 		replace_floppy();
 
-	const double it = 1000.0 / (mips_arg * 1000.0);
-	const Uint64 freq = SDL_GetPerformanceFrequency();
-	Uint64 last = SDL_GetPerformanceCounter();
-
-	for (int num_inst = 0;; num_inst++) {
-		Uint64 start = SDL_GetPerformanceCounter();
-		if ((start - last) / freq >= 1) {
-			sprintf(title_buffer, "VirtualXT @ %.2f MIPS", (double)num_inst / 1000000.0);
-			SDL_SetWindowTitle(sdl_window, title_buffer);
-			last = start;
-			num_inst = 0;
+	// SDL wants the window and its events on the main thread, so the emulator gets its own. Without threads it runs
+	// a batch between presents.
+	SDL_Thread *thread = SDL_CreateThread(emulate, "emulator", 0);
+	for (int seen_title = 0; !SDL_AtomicGet(&quit);) {
+		int redraw = pump_events();
+		if (thread) {
+			SDL_LockMutex(handover_lock);
+			if (frame_y1 <= frame_y0 && frame_seq == frame_seen && !SDL_AtomicGet(&quit))
+				SDL_CondWaitTimeout(frame_ready, handover_lock, 10);
+			SDL_UnlockMutex(handover_lock);
+		} else if (!run_batch()) {
+			break;
 		}
-
-		if (!vxt_step(e))
-			return 0;
-
-		while (mips_arg) {
-			double t = (double)((SDL_GetPerformanceCounter() - start) * 1000000) / freq;
-			if (t >= it)
-				break;
+		present(redraw);
+
+		if (seen_title != title_seq) {
+			SDL_LockMutex(handover_lock);
+			char buffer[sizeof(title_buffer)];
+			strcpy(buffer, title_buffer);
+			seen_title = title_seq;
+			SDL_UnlockMutex(handover_lock);
+			if (sdl_window) SDL_SetWindowTitle(sdl_window, buffer);
 		}
 	}
+
+	SDL_AtomicSet(&quit, 1);
+	if (thread) SDL_WaitThread(thread, 0);
+	return 0;
 }
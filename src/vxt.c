@@ -12,12 +12,99 @@
 #include <memory.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
+
+#if defined(_WIN32)
+	#include <windows.h>
+#endif
+
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
 
 // Emulator system constants
 #define IO_PORT_COUNT 0x10000
 #define RAM_SIZE 0x10FFF0
-#define REGS_BASE 0xF0000
+#define REGS_BASE 0x110000 // Register file, past the last linear address a segment:offset pair can reach
+#define REGS_SIZE 0x40 // Memory-mapped registers and flags
+#define BIOS_BASE 0xF0000
 #define VIDEO_RAM_SIZE 0x10000
+#define VIDEO_RAM_BASE 0xB0000
+
+// Predecoded instruction cache
+#define DECODE_CACHE_SIZE 0x4000 // Number of entries, must be a power of two
+#define DECODE_SPAN 6 // Number of opcode stream bytes a decoded instruction depends on
+#define CODE_PAGE_SHIFT 8
+#define CODE_PAGES ((RAM_SIZE >> CODE_PAGE_SHIFT) + 2)
+#define WATCH_CODE 1 // Page has been executed from, and may have predecoded instructions
+#define WATCH_VIDEO 2 // Page is video RAM, and writes must be shown on the next refresh
+#define NO_DECODE 0xFFFFFFFF
+
+// Idle detection
+#define IDLE_POLLS 2 // Empty INT 16h AH=01 polls in a row that make the guest idle
+#define IDLE_POLL_WINDOW 4096 // Max instructions between two polls in a row
+#define IDLE_TICK_POLLS 4 // Unchanged reads of the BIOS tick counter in a row that make the guest idle
+#define IDLE_TICK_WINDOW 64 // Max instructions between two reads in a row
+#define IDLE_RETRACE_POLLS 2 // Unchanged reads of the CGA status in a row that make the guest wait for the change
+#define IDLE_WINDOW(n) ((n) * (e->cycle_timing ? 16 : 1)) // Windows in virtual clock ticks, at about 16 cycles per instruction
+#define BDA_KBBUF_HEAD 0x41A
+#define BDA_KBBUF_TAIL 0x41C
+#define BDA_TICKS 0x46C
+
+// Instruction pairs the interpreter runs in one step
+#define FUSE_JCC 1 // CMP|TEST|INC|DEC|ALU imm followed by Jcc
+#define FUSE_STOS 2 // LODSx followed by STOSx
+
+// Basic-block core. Replays cached straight-line runs of predecoded instructions, no host code is generated.
+#define BLOCK_CACHE_SIZE 0x1000 // Number of blocks, must be a power of two
+#define BLOCK_MAX_INSTRUCTIONS 32
+
+// Cycle timing
+#define BUS_CYCLES 4 // Extra cycles per word memory transfer on the 8-bit bus of the 8088 and V20
+#define JUMP_CYCLES 12 // Extra cycles of a taken Jcc, LOOPxx or JCXZ, which refills the prefetch queue
+#define REP_CYCLES 9 // Cycles of a REP string instruction besides its elements
+#define IRQ_CYCLES 61 // Interrupt acknowledge and the call through the vector table
+#define V20_EA_CYCLES 2 // The V20 computes effective addresses in dedicated hardware
+
+// Virtual clock constants
+#define DEFAULT_VCLOCK_FREQ 1000000 // Virtual clock ticks per second until the first wall-clock sync
+#define MIN_VCLOCK_FREQ 10000
+#define SYNC_INTERVAL_US 10000
+#define SYNC_MAX_US 1000000 // Longer sync windows are treated as a stalled host and discarded
+
+// Scheduled events
+#define EVENT_TIMER 0
+#define EVENT_KEYBOARD 1
+#define EVENT_VIDEO 2
+#define MAX_EVENTS 8
+
+// I/O port devices. Ports claimed by the frontend port map have PORT_MAPPED set in addition to any built-in device.
+#define PORT_NONE 0
+#define PORT_PIC 1
+#define PORT_PIT 2
+#define PORT_SPEAKER 3
+#define PORT_KEYBOARD 4
+#define PORT_JOYSTICK 5
+#define PORT_CGA_CRTC 6
+#define PORT_CGA_STATUS 7
+#define PORT_HERCULES_CRTC 8
+#define PORT_HERCULES_STATUS 9
+#define PORT_DEVICES 10
+#define PORT_MAPPED 0x80
+
+// 8253 PIT
+#define PIT_FREQ 1193182 // Input clock of the counters
+#define PIT_NEVER ((unsigned long long)-1)
+
+// CGA raster timing in dots of the 14.318 MHz crystal, which also clocks the PIT at one twelfth the rate
+#define CGA_PIT_DOTS 12
+#define CGA_LINE_DOTS 912
+#define CGA_VISIBLE_DOTS 640
+#define CGA_FRAME_LINES 262 // About 59.92 frames per second
+#define CGA_VISIBLE_LINES 200
+#define CGA_VSYNC_LINE 224
+#define CGA_VSYNC_LINES 16
+#define CGA_FRAME_DOTS (CGA_LINE_DOTS * CGA_FRAME_LINES)
 
 // 16-bit register decodes
 #define REG_AX 0
@@ -58,38 +145,165 @@
 #define FLAG_DF 47
 #define FLAG_OF 48
 
-// Lookup tables in the BIOS binary
-#define TABLE_XLAT_OPCODE 8
-#define TABLE_XLAT_SUBFUNCTION 9
-#define TABLE_STD_FLAGS 10
-#define TABLE_PARITY_FLAG 11
-#define TABLE_BASE_INST_SIZE 12
-#define TABLE_I_W_SIZE 13
-#define TABLE_I_MOD_SIZE 14
-#define TABLE_COND_JUMP_DECODE_A 15
-#define TABLE_COND_JUMP_DECODE_B 16
-#define TABLE_COND_JUMP_DECODE_C 17
-#define TABLE_COND_JUMP_DECODE_D 18
-#define TABLE_FLAGS_BITFIELDS 19
-
-// Bitfields for TABLE_STD_FLAGS values
+// Indexes into decode_lookup
+#define TABLE_PARITY_FLAG 8
+#define TABLE_COND_JUMP_DECODE_A 9
+#define TABLE_COND_JUMP_DECODE_B 10
+#define TABLE_COND_JUMP_DECODE_C 11
+#define TABLE_COND_JUMP_DECODE_D 12
+#define TABLE_FLAGS_BITFIELDS 13
+
+// Bitfields for opcode_desc_t.set_flags_type
 #define FLAGS_UPDATE_SZP 1
 #define FLAGS_UPDATE_AO_ARITH 2
 #define FLAGS_UPDATE_OC_LOGIC 4
 
+// 8087 status and control word bits
+#define FPU_IE 0x01 // Invalid operation
+#define FPU_ZE 0x04 // Zero divide
+#define FPU_OE 0x08 // Overflow
+#define FPU_ES 0x80 // Error summary, an unmasked exception is pending
+#define FPU_C0 0x100
+#define FPU_C1 0x200
+#define FPU_C2 0x400
+#define FPU_C3 0x4000
+#define FPU_CC (FPU_C0 | FPU_C1 | FPU_C2 | FPU_C3)
+#define FPU_TOP 0x3800
+#define FPU_IEM 0x80 // Interrupt enable mask, set by FDISI
+#define FPU_CW_INIT 0x3FF
+#define FPU_EXCEPTIONS 0x3F
+
+typedef struct {
+	unsigned long long deadline;
+	int id;
+} event_t;
+
+// Predecoded instruction, keyed by linear address
+typedef struct {
+	unsigned addr;
+	short i_data0, i_data1, i_data2;
+	byte raw_opcode_id, xlat_opcode_id, extra, i_mod_size, set_flags_type, i_w, i_d, i_reg4bit, i_mod, i_rm, i_reg, fuse, cycles;
+} decoded_t;
+
+// Packed decode metadata for one raw opcode, so decoding and sizing an instruction touches a single table entry
+typedef struct {
+	byte xlat_opcode_id, extra, set_flags_type, base_size : 3, i_w_adder : 1, i_mod_adder : 1;
+} opcode_desc_t;
+
+// 8086 clocks of one raw opcode, for the register or implied operand form and the memory form without the effective
+// address calculation, and the number of word transfers the memory form makes
+typedef struct {
+	byte reg, mem, bus;
+} cycle_desc_t;
+
+// One 8253 counter. Its value is computed from the PIT clock instead of ticked: start is the PIT clock when counting
+// began, and held is the number of ticks counted when the gate went low.
+typedef struct {
+	unsigned long long start, held;
+	unsigned reload; // 1 to 65536, or 0 until a count is written
+	word latch;
+	byte mode, access, write_lsb, write_hi, read_hi, latched, counting, gate;
+} pit_channel_t;
+
+// Built-in device behind an I/O port, either handler may be null
+typedef struct {
+	void (*in)(vxt_emulator_t*,unsigned);
+	void (*out)(vxt_emulator_t*,unsigned,byte);
+} port_device_t;
+
+// Straight-line run of predecoded instructions, ending at the first instruction that leaves it.
+// A block is valid while the generation of the one or two code pages it covers is unchanged.
+typedef struct {
+	unsigned addr, last_page, gen[2];
+	int len;
+	decoded_t code[BLOCK_MAX_INSTRUCTIONS];
+} block_t;
+
 struct vxt_emulator {
-	byte mem[RAM_SIZE], io_ports[IO_PORT_COUNT];
-	byte *opcode_stream, *regs8, *vid_mem_base, *font;
-	byte i_rm, i_w, i_reg, i_mod, i_mod_size, i_d, i_reg4bit, raw_opcode_id, xlat_opcode_id, extra, rep_mode, seg_override_en, rep_override_en, trap_flag, int8_asap, scratch_uchar, io_hi_lo, spkr_en;
-	word vid_addr_lookup[VIDEO_RAM_SIZE], *regs16, reg_ip, seg_override, file_index, wave_counter;
-	unsigned int pixel_colors[16], op_source, op_dest, rm_addr, op_to_addr, op_from_addr, i_data0, i_data1, i_data2, scratch_uint, scratch2_uint, set_flags_type, GRAPHICS_X, GRAPHICS_Y, vmem_ctr;
-	int op_result, scratch_int, blink, screen_off;
+	byte mem[REGS_BASE + REGS_SIZE];
+
+	// Hot CPU state directly follows the register file at the end of mem, so executing an instruction stays within a
+	// few cache lines instead of reaching into guest RAM and across the video and port tables
+	byte *opcode_stream, *regs8;
+	word *regs16, reg_ip, seg_override;
+	byte i_rm, i_w, i_reg, i_mod, i_mod_size, i_d, i_reg4bit, raw_opcode_id, xlat_opcode_id, extra, rep_mode, seg_override_en, rep_override_en, trap_flag, pic_pending, scratch_uchar;
+	unsigned int op_source, op_dest, rm_addr, op_to_addr, op_from_addr, i_data0, i_data1, i_data2, scratch_uint, scratch2_uint, set_flags_type;
+	int op_result, scratch_int;
+	word scratch_word;
+
+	// SF/ZF/PF and AF/OF are computed from the last result only when something reads them
+	int lazy_result;
+	unsigned lazy_source, lazy_dest;
+	byte lazy_flags, lazy_w, lazy_cf;
+
+	// Virtual time is counted in executed instructions, or in modelled CPU cycles with cycle timing on. cycles is the
+	// cost of the current instruction. vclock_freq is calibrated against the wall clock at batch boundaries.
+	unsigned long long vclock, next_event, run_vclock;
+	unsigned cycles;
+	int cycle_timing;
+
+	byte io_ports[IO_PORT_COUNT];
+	byte port_in_dev[IO_PORT_COUNT], port_out_dev[IO_PORT_COUNT]; // Device that handles each port, see port_devices
+	byte *vid_mem_base, *font, spkr_en;
+	word file_index, wave_counter;
+	unsigned int GRAPHICS_X, GRAPHICS_Y, vmem_ctr;
+	int blink, screen_off, num_events;
+
 	void *mem_block;
 	vxt_drive_t *scratch_disk;
-	clock_t kb_timer, video_timer;
+
+	unsigned long long sync_vclock, sync_time, frame_count;
+	unsigned vclock_freq, fixed_freq;
+	event_t events[MAX_EVENTS];
+
+	// 8253 PIT. pit_clock counts PIT input ticks up to pit_vclock, and pit_frac is the remainder of converting virtual
+	// clock ticks. pit_irq is the PIT clock of the next rising edge of counter 0, which raises IRQ 0.
+	pit_channel_t pit[3];
+	unsigned long long pit_clock, pit_vclock, pit_irq;
+	unsigned pit_frac;
+
+	// 8259 PIC. pic_pending is the IRR bit of the request the CPU is interrupted with next, or zero. pic_init counts
+	// down the ICWs still expected on port 21h.
+	byte pic_irr, pic_isr, pic_imr, pic_base, pic_icw1, pic_init, pic_read_isr, pic_auto_eoi;
+
+	// 8087 coprocessor. fpu_st holds the physical registers, ST(i) is fpu_st[(fpu_top + i) & 7]. The TOP field of
+	// fpu_sw is kept in fpu_top, and fpu_empty has a bit set for each physical register tagged empty.
+	long double fpu_st[8];
+	word fpu_cw, fpu_sw, fpu_op;
+	byte fpu_top, fpu_empty;
+	unsigned fpu_ip, fpu_dp;
+
+	decoded_t decode_cache[DECODE_CACHE_SIZE];
+	byte code_pages[CODE_PAGES]; // WATCH_* flags. Stores to a page with any flag set go through watch_write.
+
+	// An idle guest skips virtual time ahead to the next event, and the run stops so the host can sleep
+	int idle_en, idle, idle_polls, tick_polls;
+	unsigned long long idle_skip, last_poll, last_tick_read;
+	unsigned tick_addr, tick_value;
+	byte tick_regs[2 * REG_ZERO], tick_flags[FLAG_OF - FLAG_CF + 1];
+	int retrace_polls;
+	unsigned long long last_retrace_read;
+	unsigned retrace_addr;
+	byte retrace_regs[2 * REG_ZERO], retrace_flags[FLAG_OF - FLAG_CF + 1];
+
+	vxt_cpu_t cpu;
+	vxt_core_t core;
+	int code_dirty;
+	unsigned code_gen[CODE_PAGES];
+	block_t block_cache[BLOCK_CACHE_SIZE];
 	
 	byte video_mode;
 	vxt_video_t *video;
+
+	// Video RAM pages written since the last refresh. video_full makes the next refresh redraw everything, and
+	// video_drawn is set when the last refresh drew into the backbuffer, which the frontend shows on the next call.
+	byte video_dirty[VIDEO_RAM_SIZE >> CODE_PAGE_SHIFT], video_full, video_drawn, text_cursor[3];
+	int text_blink;
+
+	// Graphics modes expand each byte of video RAM to eight pixels through gfx_expand, built for the adapter and CGA
+	// colour select register recorded in gfx_palette
+	unsigned long long gfx_expand[256];
+	unsigned gfx_palette;
 	
 	vxt_joystick_t *joystick;
 	vxt_serial_t *serial[4];
@@ -102,7 +316,8 @@ struct vxt_emulator {
 	vxt_port_map_t *port_map;
 };
 
-const word cga_colors[4] = {0 /* Black */, 0x1F1F /* Cyan */, 0xE3E3 /* Magenta */, 0xFFFF /* White */};
+// The 16 CGA colours in RGB332
+const byte cga_colors[16] = {0x00, 0x02, 0x14, 0x16, 0xA0, 0xA2, 0xA8, 0xB6, 0x49, 0x4B, 0x5D, 0x5F, 0xE9, 0xEB, 0xFD, 0xFF};
 
 // R/M mode tables
 const byte rm_mode0_reg1[]		= {3, 3, 5, 5, 6, 7, 12, 3};
@@ -114,14 +329,6 @@ const byte rm_mode12_reg1[]		= {3, 3, 5, 5, 6, 7, 5, 3};
 const byte rm_mode12_disp[]		= {1, 1, 1, 1, 1, 1, 1, 1};
 const byte rm_mode12_dfseg[]	= {11, 11, 10, 10, 11, 11, 10, 11};
 
-// Opcode decode tables
-const byte xlat_ids[]		= {9, 9, 9, 9, 7, 7, 25, 26, 9, 9, 9, 9, 7, 7, 25, 48, 9, 9, 9, 9, 7, 7, 25, 26, 9, 9, 9, 9, 7, 7, 25, 26, 9, 9, 9, 9, 7, 7, 27, 28, 9, 9, 9, 9, 7, 7, 27, 28, 9, 9, 9, 9, 7, 7, 27, 29, 9, 9, 9, 9, 7, 7, 27, 29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 51, 54, 52, 52, 52, 52, 52, 52, 55, 55, 55, 55, 52, 52, 52, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 15, 15, 24, 24, 9, 9, 9, 9, 10, 10, 10, 10, 16, 16, 16, 16, 16, 16, 16, 16, 30, 31, 32, 53, 33, 34, 35, 36, 11, 11, 11, 11, 17, 17, 18, 18, 47, 47, 17, 17, 17, 17, 18, 18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 12, 12, 19, 19, 37, 37, 20, 20, 49, 50, 19, 19, 38, 39, 40, 19, 12, 12, 12, 12, 41, 42, 43, 44, 53, 53, 53, 53, 53, 53, 53, 53, 13, 13, 13, 13, 21, 21, 22, 22, 14, 14, 14, 14, 21, 21, 22, 22, 53, 0, 23, 23, 53, 45, 6, 6, 46, 46, 46, 46, 46, 46, 5, 5};
-const byte ex_data[]		= {0, 0, 0, 0, 0, 0, 8, 8, 1, 1, 1, 1, 1, 1, 9, 36, 2, 2, 2, 2, 2, 2, 10, 10, 3, 3, 3, 3, 3, 3, 11, 11, 4, 4, 4, 4, 4, 4, 8, 0, 5, 5, 5, 5, 5, 5, 9, 1, 6, 6, 6, 6, 6, 6, 10, 2, 7, 7, 7, 7, 7, 7, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 16, 22, 0, 0, 0, 0, 1, 1, 0, 255, 48, 2, 0, 0, 0, 0, 255, 255, 40, 11, 3, 3, 3, 3, 3, 3, 3, 3, 43, 43, 43, 43, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 21, 0, 0, 2, 40, 21, 21, 80, 81, 92, 93, 94, 95, 0, 0};
-const byte std_flags[]		= {3, 3, 3, 3, 3, 3, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 5, 5, 5, 5, 5, 5, 0, 1, 3, 3, 3, 3, 3, 3, 0, 1, 5, 5, 5, 5, 5, 5, 0, 1, 3, 3, 3, 3, 3, 3, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-const byte base_size[]		= {2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 0, 0, 2, 2, 2, 2, 4, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 2};
-const byte i_w_adder[]		= {0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-const byte i_mod_adder[] 	= {1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1};
-
 const byte flags_mult[] = {0, 2, 4, 6, 7, 8, 9, 10, 11};
 
 const byte jxx_dec_a[] = {48, 40, 43, 40, 44, 41, 49, 49};
@@ -131,7 +338,7 @@ const byte jxx_dec_d[] = {49, 49, 49, 49, 49, 49, 48, 48};
 
 const byte parity[256] = {1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1};
 
-const byte* const decode_lookup[20] = {
+const byte* const decode_lookup[14] = {
 	rm_mode12_reg1, 	// Table 0: R/M mode 1/2 "register 1" lookup
 	rm_mode012_reg2, 	// Table 1: R/M mode 1/2 "register 2" lookup
 	rm_mode12_disp, 	// Table 2: R/M mode 1/2 "DISP multiplier" lookup
@@ -140,74 +347,236 @@ const byte* const decode_lookup[20] = {
 	rm_mode012_reg2, 	// Table 5: R/M mode 0 "register 2" lookup
 	rm_mode0_disp, 		// Table 6: R/M mode 0 "DISP multiplier" lookup
 	rm_mode0_dfseg, 	// Table 7: R/M mode 0 "default segment" lookup
-	xlat_ids, 			// Table 8: Translation of raw opcode index ("Raw ID") to function number ("Xlat'd ID")
-	ex_data, 			// Table 9: Translation of Raw ID to Extra Data
-	std_flags, 			// Table 10: How each Raw ID sets the flags (bit 1 = sets SZP, bit 2 = sets AF/OF for arithmetic, bit 3 = sets OF/CF for logic)
-	parity, 			// Table 11: Parity flag loop-up table (256 entries)
-	base_size, 			// Table 12: Translation of Raw ID to base instruction size (bytes)
-	i_w_adder, 			// Table 13: Translation of Raw ID to i_w size adder yes/no
-	i_mod_adder, 		// Table 14: Translation of Raw ID to i_mod size adder yes/no
-	jxx_dec_a, 			// Table 15: Jxx decode table A
-	jxx_dec_b, 			// Table 16: Jxx decode table B
-	jxx_dec_c, 			// Table 17: Jxx decode table C
-	jxx_dec_d, 			// Table 18: Jxx decode table D
-	flags_mult 			// Table 19: FLAGS multipliers
+	parity, 			// Table 8: Parity flag loop-up table (256 entries)
+	jxx_dec_a, 			// Table 9: Jxx decode table A
+	jxx_dec_b, 			// Table 10: Jxx decode table B
+	jxx_dec_c, 			// Table 11: Jxx decode table C
+	jxx_dec_d, 			// Table 12: Jxx decode table D
+	flags_mult 			// Table 13: FLAGS multipliers
 };
 
+// Decode metadata per raw opcode ("Raw ID") as {function number ("Xlat'd ID"), extra data, how the opcode sets the flags,
+// base instruction size in bytes, i_w size adder yes/no, i_mod size adder yes/no}. This is the only copy.
+const opcode_desc_t opcode_table[256] = {
+	{9, 0, 3, 2, 0, 1}, {9, 0, 3, 2, 0, 1}, {9, 0, 3, 2, 0, 1}, {9, 0, 3, 2, 0, 1}, {7, 0, 3, 1, 1, 0}, {7, 0, 3, 1, 1, 0}, {25, 8, 0, 1, 0, 0}, {26, 8, 0, 1, 0, 0}, // 00
+	{9, 1, 5, 2, 0, 1}, {9, 1, 5, 2, 0, 1}, {9, 1, 5, 2, 0, 1}, {9, 1, 5, 2, 0, 1}, {7, 1, 5, 1, 1, 0}, {7, 1, 5, 1, 1, 0}, {25, 9, 0, 1, 0, 0}, {48, 36, 0, 2, 0, 0}, // 08
+	{9, 2, 1, 2, 0, 1}, {9, 2, 1, 2, 0, 1}, {9, 2, 1, 2, 0, 1}, {9, 2, 1, 2, 0, 1}, {7, 2, 1, 1, 1, 0}, {7, 2, 1, 1, 1, 0}, {25, 10, 0, 1, 0, 0}, {26, 10, 0, 1, 0, 0}, // 10
+	{9, 3, 1, 2, 0, 1}, {9, 3, 1, 2, 0, 1}, {9, 3, 1, 2, 0, 1}, {9, 3, 1, 2, 0, 1}, {7, 3, 1, 1, 1, 0}, {7, 3, 1, 1, 1, 0}, {25, 11, 0, 1, 0, 0}, {26, 11, 0, 1, 0, 0}, // 18
+	{9, 4, 5, 2, 0, 1}, {9, 4, 5, 2, 0, 1}, {9, 4, 5, 2, 0, 1}, {9, 4, 5, 2, 0, 1}, {7, 4, 5, 1, 1, 0}, {7, 4, 5, 1, 1, 0}, {27, 8, 0, 1, 0, 0}, {28, 0, 1, 1, 0, 0}, // 20
+	{9, 5, 3, 2, 0, 1}, {9, 5, 3, 2, 0, 1}, {9, 5, 3, 2, 0, 1}, {9, 5, 3, 2, 0, 1}, {7, 5, 3, 1, 1, 0}, {7, 5, 3, 1, 1, 0}, {27, 9, 0, 1, 0, 0}, {28, 1, 1, 1, 0, 0}, // 28
+	{9, 6, 5, 2, 0, 1}, {9, 6, 5, 2, 0, 1}, {9, 6, 5, 2, 0, 1}, {9, 6, 5, 2, 0, 1}, {7, 6, 5, 1, 1, 0}, {7, 6, 5, 1, 1, 0}, {27, 10, 0, 1, 0, 0}, {29, 2, 1, 1, 0, 0}, // 30
+	{9, 7, 3, 2, 0, 1}, {9, 7, 3, 2, 0, 1}, {9, 7, 3, 2, 0, 1}, {9, 7, 3, 2, 0, 1}, {7, 7, 3, 1, 1, 0}, {7, 7, 3, 1, 1, 0}, {27, 11, 0, 1, 0, 0}, {29, 0, 1, 1, 0, 0}, // 38
+	{2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, {2, 0, 1, 1, 0, 0}, // 40
+	{2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, {2, 1, 1, 1, 0, 0}, // 48
+	{3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, {3, 0, 0, 1, 0, 0}, // 50
+	{4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, {4, 0, 0, 1, 0, 0}, // 58
+	{51, 0, 0, 1, 0, 0}, {54, 0, 0, 1, 0, 0}, {56, 0, 0, 2, 0, 1}, {52, 21, 0, 1, 0, 0}, {52, 21, 0, 1, 0, 0}, {52, 21, 0, 1, 0, 0}, {52, 21, 0, 1, 0, 0}, {52, 21, 0, 1, 0, 0}, // 60
+	{55, 0, 0, 3, 0, 0}, {55, 1, 0, 4, 0, 1}, {55, 2, 0, 2, 0, 0}, {55, 3, 0, 3, 0, 1}, {57, 0, 0, 1, 0, 0}, {57, 0, 0, 1, 0, 0}, {57, 1, 0, 1, 0, 0}, {57, 1, 0, 1, 0, 0}, // 68
+	{0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, // 70
+	{0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, {0, 21, 0, 2, 0, 0}, // 78
+	{8, 0, 1, 2, 1, 1}, {8, 0, 1, 2, 1, 1}, {8, 0, 1, 2, 1, 1}, {8, 0, 1, 2, 1, 1}, {15, 0, 5, 2, 0, 1}, {15, 0, 5, 2, 0, 1}, {24, 0, 0, 2, 0, 1}, {24, 0, 0, 2, 0, 1}, // 80
+	{9, 8, 0, 2, 0, 1}, {9, 8, 0, 2, 0, 1}, {9, 8, 0, 2, 0, 1}, {9, 8, 0, 2, 0, 1}, {10, 12, 0, 2, 0, 1}, {10, 12, 0, 2, 0, 1}, {10, 12, 0, 2, 0, 1}, {10, 12, 0, 2, 0, 1}, // 88
+	{16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, {16, 0, 0, 1, 0, 0}, // 90
+	{30, 0, 0, 1, 0, 0}, {31, 0, 0, 1, 0, 0}, {32, 0, 0, 0, 0, 0}, {53, 0, 0, 1, 0, 0}, {33, 0, 0, 1, 0, 0}, {34, 0, 0, 1, 0, 0}, {35, 255, 0, 1, 0, 0}, {36, 0, 0, 1, 0, 0}, // 98
+	{11, 0, 0, 3, 0, 0}, {11, 0, 0, 3, 0, 0}, {11, 0, 0, 3, 0, 0}, {11, 0, 0, 3, 0, 0}, {17, 0, 0, 1, 0, 0}, {17, 0, 0, 1, 0, 0}, {18, 0, 0, 1, 0, 0}, {18, 0, 0, 1, 0, 0}, // A0
+	{47, 0, 5, 1, 1, 0}, {47, 0, 5, 1, 1, 0}, {17, 1, 0, 1, 0, 0}, {17, 1, 0, 1, 0, 0}, {17, 2, 0, 1, 0, 0}, {17, 2, 0, 1, 0, 0}, {18, 1, 0, 1, 0, 0}, {18, 1, 0, 1, 0, 0}, // A8
+	{1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, // B0
+	{1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, {1, 0, 0, 1, 1, 0}, // B8
+	{12, 1, 0, 3, 0, 1}, {12, 1, 0, 3, 0, 1}, {19, 0, 0, 0, 0, 0}, {19, 0, 0, 0, 0, 0}, {37, 16, 0, 2, 0, 1}, {37, 22, 0, 2, 0, 1}, {20, 0, 0, 2, 1, 1}, {20, 0, 0, 2, 1, 1}, // C0
+	{49, 0, 0, 4, 0, 0}, {50, 0, 0, 1, 0, 0}, {19, 1, 0, 0, 0, 0}, {19, 1, 0, 0, 0, 0}, {38, 0, 0, 0, 0, 0}, {39, 255, 0, 0, 0, 0}, {40, 48, 0, 0, 0, 0}, {19, 2, 0, 0, 0, 0}, // C8
+	{12, 0, 0, 2, 0, 1}, {12, 0, 0, 2, 0, 1}, {12, 0, 0, 2, 0, 1}, {12, 0, 0, 2, 0, 1}, {41, 255, 5, 2, 0, 0}, {42, 255, 5, 2, 0, 0}, {43, 40, 0, 1, 0, 0}, {44, 11, 0, 1, 0, 0}, // D0
+	{53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, {53, 3, 0, 2, 0, 1}, // D8
+	{13, 43, 0, 2, 0, 0}, {13, 43, 0, 2, 0, 0}, {13, 43, 0, 2, 0, 0}, {13, 43, 0, 2, 0, 0}, {21, 0, 0, 2, 0, 0}, {21, 0, 0, 2, 0, 0}, {22, 0, 0, 2, 0, 0}, {22, 0, 0, 2, 0, 0}, // E0
+	{14, 0, 0, 0, 0, 0}, {14, 0, 0, 0, 0, 0}, {14, 0, 0, 0, 0, 0}, {14, 0, 0, 0, 0, 0}, {21, 1, 0, 1, 0, 0}, {21, 1, 0, 1, 0, 0}, {22, 1, 0, 1, 0, 0}, {22, 1, 0, 1, 0, 0}, // E8
+	{53, 1, 0, 1, 0, 0}, {0, 21, 0, 2, 0, 0}, {23, 0, 0, 1, 0, 0}, {23, 0, 0, 1, 0, 0}, {53, 2, 0, 1, 0, 0}, {45, 40, 0, 1, 0, 0}, {6, 21, 0, 2, 0, 1}, {6, 21, 0, 2, 0, 1}, // F0
+	{46, 80, 0, 1, 0, 0}, {46, 81, 0, 1, 0, 0}, {46, 92, 0, 1, 0, 0}, {46, 93, 0, 1, 0, 0}, {46, 94, 0, 1, 0, 0}, {46, 95, 0, 1, 0, 0}, {5, 0, 0, 2, 0, 1}, {5, 0, 0, 2, 0, 1}, // F8
+};
+
+// Cycle costs per Raw ID. Group opcodes F6, F7 and FF take theirs from the tables below, indexed by the reg field.
+const cycle_desc_t cycle_table[256] = {
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {14, 0, 0}, {12, 0, 0}, // 00
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {14, 0, 0}, {12, 0, 0}, // 08
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {14, 0, 0}, {12, 0, 0}, // 10
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {14, 0, 0}, {12, 0, 0}, // 18
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {2, 0, 0}, {4, 0, 0}, // 20
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {2, 0, 0}, {4, 0, 0}, // 28
+	{3, 16, 0}, {3, 16, 2}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {2, 0, 0}, {4, 0, 0}, // 30
+	{3, 9, 0}, {3, 9, 1}, {3, 9, 0}, {3, 9, 1}, {4, 0, 0}, {4, 0, 0}, {2, 0, 0}, {4, 0, 0}, // 38
+	{2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, // 40
+	{2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, // 48
+	{15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, // 50
+	{12, 0, 0}, {12, 0, 0}, {12, 0, 0}, {12, 0, 0}, {12, 0, 0}, {12, 0, 0}, {12, 0, 0}, {12, 0, 0}, // 58
+	{67, 0, 0}, {75, 0, 0}, {35, 35, 2}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, // 60
+	{11, 0, 0}, {30, 37, 1}, {11, 0, 0}, {30, 37, 1}, {8, 0, 0}, {12, 0, 0}, {8, 0, 0}, {12, 0, 0}, // 68
+	{4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, // 70
+	{4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, // 78
+	{4, 17, 0}, {4, 17, 2}, {4, 17, 0}, {4, 17, 2}, {3, 9, 0}, {3, 9, 1}, {4, 17, 0}, {4, 17, 2}, // 80
+	{2, 9, 0}, {2, 9, 1}, {2, 8, 0}, {2, 8, 1}, {2, 9, 1}, {2, 2, 0}, {2, 8, 1}, {12, 17, 2}, // 88
+	{3, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0}, // 90
+	{2, 0, 0}, {5, 0, 0}, {36, 0, 0}, {4, 0, 0}, {14, 0, 0}, {12, 0, 0}, {4, 0, 0}, {4, 0, 0}, // 98
+	{10, 0, 0}, {14, 0, 0}, {10, 0, 0}, {14, 0, 0}, {18, 0, 0}, {26, 0, 0}, {22, 0, 0}, {30, 0, 0}, // A0
+	{4, 0, 0}, {4, 0, 0}, {11, 0, 0}, {15, 0, 0}, {12, 0, 0}, {16, 0, 0}, {15, 0, 0}, {19, 0, 0}, // A8
+	{4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, // B0
+	{4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, {4, 0, 0}, // B8
+	{5, 17, 0}, {5, 17, 2}, {24, 0, 0}, {20, 0, 0}, {24, 24, 0}, {24, 24, 0}, {4, 10, 0}, {4, 10, 1}, // C0
+	{23, 0, 0}, {12, 0, 0}, {33, 0, 0}, {32, 0, 0}, {72, 0, 0}, {71, 0, 0}, {4, 0, 0}, {44, 0, 0}, // C8
+	{2, 15, 0}, {2, 15, 2}, {8, 20, 0}, {8, 20, 2}, {83, 0, 0}, {60, 0, 0}, {4, 0, 0}, {11, 0, 0}, // D0
+	{2, 8, 0}, {2, 8, 0}, {2, 8, 0}, {2, 8, 0}, {2, 8, 0}, {2, 8, 0}, {2, 8, 0}, {2, 8, 0}, // D8
+	{5, 0, 0}, {6, 0, 0}, {5, 0, 0}, {6, 0, 0}, {10, 0, 0}, {14, 0, 0}, {10, 0, 0}, {14, 0, 0}, // E0
+	{23, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {8, 0, 0}, {12, 0, 0}, {8, 0, 0}, {12, 0, 0}, // E8
+	{2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {0, 0, 0}, {0, 0, 0}, // F0
+	{2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {2, 0, 0}, {3, 15, 0}, {0, 0, 0}, // F8
+};
+
+// TEST|???|NOT|NEG|MUL|IMUL|DIV|IDIV per CPU and operand size, as {register, memory without EA}. Word transfers included.
+const byte grp3_cycles[2][2][8][2] = {
+	{{{5, 11}, {5, 11}, {3, 16}, {3, 16}, {73, 80}, {89, 96}, {85, 91}, {106, 112}},
+	 {{5, 15}, {5, 15}, {3, 24}, {3, 24}, {125, 135}, {141, 150}, {153, 162}, {174, 184}}},
+	{{{4, 10}, {4, 10}, {5, 16}, {5, 16}, {21, 27}, {36, 42}, {19, 25}, {31, 37}},
+	 {{4, 14}, {4, 14}, {5, 24}, {5, 24}, {30, 40}, {44, 54}, {25, 35}, {40, 50}}}
+};
+
+// INC|DEC|CALL|CALL far|JMP|JMP far|PUSH|??? r/m16, as {register, memory without EA}. Word transfers included.
+const byte grp5_cycles[8][2] = {{2, 23}, {2, 23}, {20, 29}, {53, 53}, {11, 22}, {32, 32}, {15, 24}, {15, 24}};
+
+// Effective address calculation for mod 0 and mod 1/2, by r/m
+const byte ea_cycles[2][8] = {{7, 8, 8, 7, 5, 5, 6, 5}, {11, 12, 12, 11, 9, 9, 9, 9}};
+
 // Helper macros
 
+// The _N variants take operand width (w) and direction (d) as arguments rather than from i_w/i_d, so they fold away
+// where these are known at compile time
+
+// Invalidate predecoded instructions and mark video RAM dirty under a write of the current operand size at linear
+// address addr
+#define CODE_WRITE(addr) CODE_WRITE_N(e->i_w,addr)
+#define CODE_WRITE_N(w,addr) ((e->code_pages[(addr) >> CODE_PAGE_SHIFT] | e->code_pages[((addr) + (w)) >> CODE_PAGE_SHIFT]) && (watch_write(e, addr, (w) + 1), 0))
+
 // Decode mod, r_m and reg fields in instruction
-#define DECODE_RM_REG e->scratch2_uint = 4 * !e->i_mod, \
-					  e->op_to_addr = e->rm_addr = e->i_mod < 3 ? SEGREG(e->seg_override_en ? e->seg_override : decode_lookup[e->scratch2_uint + 3][e->i_rm], decode_lookup[e->scratch2_uint][e->i_rm], e->regs16[decode_lookup[e->scratch2_uint + 1][e->i_rm]] + decode_lookup[e->scratch2_uint + 2][e->i_rm] * e->i_data1+) : GET_REG_ADDR(e->i_rm), \
-					  e->op_from_addr = GET_REG_ADDR(e->i_reg), \
-					  e->i_d && (e->scratch_uint = e->op_from_addr, e->op_from_addr = e->rm_addr, e->op_to_addr = e->scratch_uint)
+#define DECODE_RM_REG DECODE_RM_REG_N(e->i_w,e->i_d)
+#define DECODE_RM_REG_N(w,d) e->scratch2_uint = 4 * !e->i_mod, \
+					  e->op_to_addr = e->rm_addr = e->i_mod < 3 ? SEGREG(e->seg_override_en ? e->seg_override : decode_lookup[e->scratch2_uint + 3][e->i_rm], decode_lookup[e->scratch2_uint][e->i_rm], e->regs16[decode_lookup[e->scratch2_uint + 1][e->i_rm]] + decode_lookup[e->scratch2_uint + 2][e->i_rm] * e->i_data1+) : GET_REG_ADDR_N(w, e->i_rm), \
+					  e->op_from_addr = GET_REG_ADDR_N(w, e->i_reg), \
+					  (d) && (e->scratch_uint = e->op_from_addr, e->op_from_addr = e->rm_addr, e->op_to_addr = e->scratch_uint), \
+					  e->rm_addr - BDA_TICKS < 4 && watch_ticks(e)
 
 // Return memory-mapped register location (offset into mem array) for register #reg_id
-#define GET_REG_ADDR(reg_id) (REGS_BASE + (e->i_w ? 2 * reg_id : (2 * reg_id + reg_id / 4) & 7))
+#define GET_REG_ADDR(reg_id) GET_REG_ADDR_N(e->i_w,reg_id)
+#define GET_REG_ADDR_N(w,reg_id) (REGS_BASE + ((w) ? 2 * reg_id : (2 * reg_id + reg_id / 4) & 7))
 
 // Returns number of top bit in operand (i.e. 8 for 8-bit operands, 16 for 16-bit operands)
 #define TOP_BIT 8*(e->i_w + 1)
 
+// Virtual clock ticks of the instruction that just ran
+#define INSTRUCTION_TICKS (e->cycle_timing ? e->cycles : 1)
+
 // Opcode execution unit helpers
 #define OPCODE ;break; case
 #define OPCODE_CHAIN ; case
 
 // [I]MUL/[I]DIV/DAA/DAS/ADC/SBB helpers
 #define MUL_MACRO(op_data_type,out_regs) (set_opcode(e, 0x10), \
-										  out_regs[e->i_w + 1] = (e->op_result = CAST(op_data_type)e->mem[e->rm_addr] * (op_data_type)*out_regs) >> 16, \
+										  out_regs[e->i_w + 1] = (e->op_result = (op_data_type)read_operand(e, e->rm_addr) * (op_data_type)*out_regs) >> 16, \
 										  e->regs16[REG_AX] = e->op_result, \
 										  set_OF(e, set_CF(e, e->op_result - (op_data_type)e->op_result)))
-#define DIV_MACRO(out_data_type,in_data_type,out_regs) (e->scratch_int = CAST(out_data_type)e->mem[e->rm_addr]) && !(e->scratch2_uint = (in_data_type)(e->scratch_uint = (out_regs[e->i_w+1] << 16) + e->regs16[REG_AX]) / e->scratch_int, e->scratch2_uint - (out_data_type)e->scratch2_uint) ? out_regs[e->i_w+1] = e->scratch_uint - e->scratch_int * (*out_regs = e->scratch2_uint) : pc_interrupt(e, 0)
+#define DIV_MACRO(out_data_type,in_data_type,out_regs) (e->scratch_int = (out_data_type)read_operand(e, e->rm_addr)) && !(e->scratch2_uint = (in_data_type)(e->scratch_uint = (out_regs[e->i_w+1] << 16) + e->regs16[REG_AX]) / e->scratch_int, e->scratch2_uint - (out_data_type)e->scratch2_uint) ? out_regs[e->i_w+1] = e->scratch_uint - e->scratch_int * (*out_regs = e->scratch2_uint) : pc_interrupt(e, 0)
 #define DAA_DAS(op1,op2,mask,min) set_AF(e, (((e->scratch2_uint = e->regs8[REG_AL]) & 0x0F) > 9) || e->regs8[FLAG_AF]) && (e->op_result = e->regs8[REG_AL] op1 6, set_CF(e, e->regs8[FLAG_CF] || (e->regs8[REG_AL] op2 e->scratch2_uint))), \
 								  set_CF(e, (((mask & 1 ? e->scratch2_uint : e->regs8[REG_AL]) & mask) > min) || e->regs8[FLAG_CF]) && (e->op_result = e->regs8[REG_AL] op1 0x60)
-#define ADC_SBB_MACRO(a) OP(a##= e->regs8[FLAG_CF] +), \
-						 set_CF(e, (e->regs8[FLAG_CF] && (e->op_result == e->op_dest)) || (a e->op_result < a(int)e->op_dest)), \
+#define ADC_SBB_MACRO(a) OP_W(a##= e->regs8[FLAG_CF] +), \
+						 set_CF(e, (e->regs8[FLAG_CF] && ((unsigned)e->op_result == e->op_dest)) || (a e->op_result < a(int)e->op_dest)), \
 						 set_AF_OF_arith(e)
 
-// Execute arithmetic/logic operations in emulator memory/registers
-#define R_M_OP(dest,op,src) (e->i_w ? e->op_dest = CAST(unsigned short)dest, e->op_result = CAST(unsigned short)dest op (e->op_source = CAST(unsigned short)src) \
-								 : (e->op_dest = dest, e->op_result = dest op (e->op_source = CAST(unsigned char)src)))
-#define MEM_OP(dest,op,src) R_M_OP(e->mem[dest],op,e->mem[src])
+// Execute arithmetic/logic operations in emulator memory/registers. dest is an offset into mem, src a value.
+// Words are operated on in scratch_word and stored back, so op can be any assignment or binary operator.
+#define R_M_OP(dest,op,src) R_M_OP_N(e->i_w,dest,op,src)
+#define R_M_OP_N(w,dest,op,src) ((w) ? e->op_dest = e->scratch_word = load16(e->mem + (dest)), e->op_result = e->scratch_word op (e->op_source = (unsigned short)(src)), store16(e->mem + (dest), e->scratch_word), e->op_result \
+									  : (e->op_dest = e->mem[dest], e->op_result = e->mem[dest] op (e->op_source = (unsigned char)(src))))
+#define MEM_OP(dest,op,src) MEM_OP_N(e->i_w,dest,op,src)
+#define MEM_OP_N(w,dest,op,src) R_M_OP_N(w,dest,op,(w) ? load16(e->mem + (src)) : e->mem[src])
 #define OP(op) MEM_OP(e->op_to_addr,op,e->op_from_addr)
 
+// Same as MEM_OP/OP but for operations that store their result
+#define MEM_OP_W(dest,op,src) (MEM_OP(dest,op,src), CODE_WRITE(dest))
+#define MEM_OP_W_N(w,dest,op,src) (MEM_OP_N(w,dest,op,src), CODE_WRITE_N(w,dest))
+#define OP_W(op) MEM_OP_W(e->op_to_addr,op,e->op_from_addr)
+
 // Increment or decrement a register #reg_id (usually SI or DI), depending on direction flag and operand size (given by i_w)
 #define INDEX_INC(reg_id) (e->regs16[reg_id] -= (2 * e->regs8[FLAG_DF] - 1)*(e->i_w + 1))
 
 // Helpers for stack operations
-#define R_M_PUSH(a) (e->i_w = 1, R_M_OP(e->mem[SEGREG(REG_SS, REG_SP, --)], =, a))
-#define R_M_POP(a) (e->i_w = 1, e->regs16[REG_SP] += 2, R_M_OP(a, =, e->mem[SEGREG(REG_SS, REG_SP, -2+)]))
+#define R_M_PUSH(a) (e->i_w = 1, e->regs16[REG_SP] -= 2, R_M_OP(SEGREG(REG_SS, REG_SP,), =, a), CODE_WRITE(SEGREG(REG_SS, REG_SP,)))
+#define R_M_POP(a) (e->i_w = 1, e->regs16[REG_SP] += 2, (a) = e->op_result = load16(e->mem + SEGREG(REG_SS, REG_SP, -2+)))
 
 // Convert segment:offset to linear address in emulator memory space
 #define SEGREG(reg_seg,reg_ofs,op) 16 * e->regs16[reg_seg] + (unsigned short)(op e->regs16[reg_ofs])
 
 // Returns sign bit of an 8-bit or 16-bit operand
-#define SIGN_OF(a) (1 & (e->i_w ? CAST(short)a : a) >> (TOP_BIT - 1))
-
-// Reinterpretation cast
-#define CAST(a) *(a*)&
+#define SIGN_OF(a) (1 & (a) >> (TOP_BIT - 1))
 
 // Helper functions
 
+// Unaligned little-endian accessors for guest memory and the register file. These compile to single loads and stores,
+// and unlike pointer casts they may alias anything, so the core builds with strict aliasing.
+static byte load8(const byte *p) { return *p; }
+static word load16(const byte *p) { word v; memcpy(&v, p, sizeof(v)); return v; }
+static void store16(byte *p, word v) { memcpy(p, &v, sizeof(v)); }
+static unsigned load32(const byte *p) { unsigned v; memcpy(&v, p, sizeof(v)); return v; }
+static void store32(byte *p, unsigned v) { memcpy(p, &v, sizeof(v)); }
+static void store64(byte *p, unsigned long long v) { memcpy(p, &v, sizeof(v)); }
+
+// Compute the flags from the recorded result of the last flag-setting instruction
+static void sync_flags(vxt_emulator_t *e)
+{
+	if (e->lazy_flags & FLAGS_UPDATE_SZP)
+	{
+		e->regs8[FLAG_SF] = 1 & e->lazy_result >> (8 * e->lazy_w + 7);
+		e->regs8[FLAG_ZF] = !e->lazy_result;
+		e->regs8[FLAG_PF] = decode_lookup[TABLE_PARITY_FLAG][(unsigned char)e->lazy_result];
+	}
+	if (e->lazy_flags & FLAGS_UPDATE_AO_ARITH)
+	{
+		e->regs8[FLAG_AF] = !!(e->lazy_source & 0x10);
+		e->regs8[FLAG_OF] = (unsigned)e->lazy_result != e->lazy_dest && 1 & (e->lazy_cf ^ e->lazy_source >> (8 * e->lazy_w + 7));
+	}
+	e->lazy_flags = 0;
+}
+
+// Read a single flag without resolving the others
+static char get_flag(vxt_emulator_t *e, int flag)
+{
+	if (e->lazy_flags) switch (flag)
+	{
+		case FLAG_SF: return 1 & e->lazy_result >> (8 * e->lazy_w + 7);
+		case FLAG_ZF: return !e->lazy_result;
+		case FLAG_PF: return decode_lookup[TABLE_PARITY_FLAG][(unsigned char)e->lazy_result];
+		case FLAG_AF: if (e->lazy_flags & FLAGS_UPDATE_AO_ARITH) return !!(e->lazy_source & 0x10); break;
+		case FLAG_OF: if (e->lazy_flags & FLAGS_UPDATE_AO_ARITH) return (unsigned)e->lazy_result != e->lazy_dest && 1 & (e->lazy_cf ^ e->lazy_source >> (8 * e->lazy_w + 7)); break;
+	}
+	return e->regs8[flag];
+}
+
+// If instruction needs to update SF, ZF and PF, record the result so they can be computed when read.
+// A pending AF/OF that this instruction does not replace is resolved first.
+static void update_flags(vxt_emulator_t *e, unsigned set_flags_type)
+{
+	if (set_flags_type & FLAGS_UPDATE_SZP)
+	{
+		if (e->lazy_flags & ~set_flags_type & FLAGS_UPDATE_AO_ARITH)
+			sync_flags(e);
+		e->lazy_flags = set_flags_type & (FLAGS_UPDATE_SZP | FLAGS_UPDATE_AO_ARITH);
+		e->lazy_result = e->op_result;
+		e->lazy_w = e->i_w;
+
+		// If instruction is an arithmetic or logic operation, also record or set AF/OF/CF as appropriate.
+		if (set_flags_type & FLAGS_UPDATE_AO_ARITH)
+			e->lazy_source = e->op_source ^= e->op_dest ^ e->op_result,
+			e->lazy_dest = e->op_dest,
+			e->lazy_cf = e->regs8[FLAG_CF];
+		if (set_flags_type & FLAGS_UPDATE_OC_LOGIC)
+			e->regs8[FLAG_CF] = e->regs8[FLAG_OF] = 0;
+	}
+}
+
 // Set carry flag
 static char set_CF(vxt_emulator_t *e, int new_CF)
 {
@@ -217,12 +586,16 @@ static char set_CF(vxt_emulator_t *e, int new_CF)
 // Set auxiliary flag
 static char set_AF(vxt_emulator_t *e, int new_AF)
 {
+	if (e->lazy_flags)
+		sync_flags(e);
 	return e->regs8[FLAG_AF] = !!new_AF;
 }
 
 // Set overflow flag
 static char set_OF(vxt_emulator_t *e, int new_OF)
 {
+	if (e->lazy_flags)
+		sync_flags(e);
 	return e->regs8[FLAG_OF] = !!new_OF;
 }
 
@@ -239,6 +612,7 @@ static char set_AF_OF_arith(vxt_emulator_t *e)
 // Assemble and return emulated CPU FLAGS register in scratch_uint
 static void make_flags(vxt_emulator_t *e)
 {
+	sync_flags(e);
 	e->scratch_uint = 0xF002; // 8086 has reserved and unused flags set to 1
 	for (int i = 9; i--;)
 		e->scratch_uint += e->regs8[FLAG_CF + i] << decode_lookup[TABLE_FLAGS_BITFIELDS][i];
@@ -247,6 +621,7 @@ static void make_flags(vxt_emulator_t *e)
 // Set emulated CPU FLAGS register from regs8[FLAG_xx] values
 static void set_flags(vxt_emulator_t *e, int new_flags)
 {
+	e->lazy_flags = 0;
 	for (int i = 9; i--;)
 		e->regs8[FLAG_CF + i] = !!(1 << decode_lookup[TABLE_FLAGS_BITFIELDS][i] & new_flags);
 }
@@ -255,10 +630,265 @@ static void set_flags(vxt_emulator_t *e, int new_flags)
 // instructions into a much smaller number of distinct functions, which we then execute
 static void set_opcode(vxt_emulator_t *e, unsigned char opcode)
 {
-	e->xlat_opcode_id = decode_lookup[TABLE_XLAT_OPCODE][e->raw_opcode_id = opcode];
-	e->extra = decode_lookup[TABLE_XLAT_SUBFUNCTION][opcode];
-	e->i_mod_size = decode_lookup[TABLE_I_MOD_SIZE][opcode];
-	e->set_flags_type = decode_lookup[TABLE_STD_FLAGS][opcode];
+	const opcode_desc_t *desc = &opcode_table[e->raw_opcode_id = opcode];
+	e->xlat_opcode_id = desc->xlat_opcode_id;
+	e->extra = desc->extra;
+	e->i_mod_size = desc->i_mod_adder;
+	e->set_flags_type = desc->set_flags_type;
+}
+
+// Remove cached instructions that depend on any of the len bytes at linear address addr
+static void invalidate_code(vxt_emulator_t *e, unsigned addr, unsigned len)
+{
+	unsigned first = addr - (DECODE_SPAN - 1), span = len + DECODE_SPAN - 1;
+	for (unsigned i = 0; i < span && i < DECODE_CACHE_SIZE; i++)
+	{
+		decoded_t *d = &e->decode_cache[(first + i) & (DECODE_CACHE_SIZE - 1)];
+		if (d->addr - first < span)
+			d->addr = NO_DECODE;
+	}
+
+	// Retire blocks covering the written bytes, and let a running block know it may have been overwritten
+	for (unsigned page = addr >> CODE_PAGE_SHIFT; page <= (addr + len - 1) >> CODE_PAGE_SHIFT && page < CODE_PAGES; page++)
+		e->code_gen[page]++;
+	e->code_dirty = 1;
+}
+
+// Invalidate cached code overlapping a store if any of the pages it touches have been executed from, and mark the
+// video RAM pages it touches dirty
+static void watch_write(vxt_emulator_t *e, unsigned addr, unsigned len)
+{
+	byte watch = 0;
+	for (unsigned page = addr >> CODE_PAGE_SHIFT; page <= (addr + len - 1) >> CODE_PAGE_SHIFT && page < CODE_PAGES; page++)
+	{
+		watch |= e->code_pages[page];
+		e->code_pages[page] & WATCH_VIDEO && (e->video_dirty[page - (VIDEO_RAM_BASE >> CODE_PAGE_SHIFT)] = 1);
+	}
+
+	if (watch & WATCH_CODE)
+		invalidate_code(e, addr, len);
+}
+
+// The 8088 decodes 60-6F as 70-7F and C8-C9 as CA-CB. The shift and rotate by immediate at C0-C1 is kept in both
+// modes, since the BIOS uses it.
+static byte cpu_opcode(vxt_emulator_t *e, byte op)
+{
+	if (e->cpu == VXT_CPU_V20)
+		return op;
+	return (op & 0xF0) == 0x60 ? op + 0x10 : (op & 0xFE) == 0xC8 ? op + 2 : op;
+}
+
+// Modelled cycles of the decoded instruction, before the costs that depend on register values. Memory operands add the
+// effective address calculation and BUS_CYCLES for each word transfer.
+static byte instruction_cycles(vxt_emulator_t *e)
+{
+	const cycle_desc_t *c = &cycle_table[e->raw_opcode_id];
+	int mem = e->i_mod_size && e->i_mod != 3;
+	unsigned n = e->raw_opcode_id == 0xF6 || e->raw_opcode_id == 0xF7 ? grp3_cycles[e->cpu][e->i_w][e->i_reg][mem]
+		: e->raw_opcode_id == 0xFF ? grp5_cycles[e->i_reg][mem]
+		: mem ? c->mem + BUS_CYCLES * c->bus : c->reg;
+	if (mem)
+		n += e->cpu == VXT_CPU_V20 ? V20_EA_CYCLES : ea_cycles[!!e->i_mod][e->i_rm];
+	return n;
+}
+
+// Decode the instruction at the opcode stream into the emulator decode fields
+static void decode_instruction(vxt_emulator_t *e)
+{
+	set_opcode(e, cpu_opcode(e, *e->opcode_stream));
+
+	// Extract i_w and i_d fields from instruction
+	e->i_w = (e->i_reg4bit = e->raw_opcode_id & 7) & 1;
+	e->i_d = e->i_reg4bit / 2 & 1;
+
+	// Extract instruction data fields
+	e->i_data0 = (short)load16(e->opcode_stream + 1);
+	e->i_data1 = (short)load16(e->opcode_stream + 2);
+	e->i_data2 = (short)load16(e->opcode_stream + 3);
+
+	// i_mod_size > 0 indicates that opcode uses i_mod/i_rm/i_reg, so decode them
+	if (e->i_mod_size)
+	{
+		e->i_mod = (e->i_data0 & 0xFF) >> 6;
+		e->i_rm = e->i_data0 & 7;
+		e->i_reg = e->i_data0 / 8 & 7;
+
+		if ((!e->i_mod && e->i_rm == 6) || (e->i_mod == 2))
+			e->i_data2 = (short)load16(e->opcode_stream + 4);
+		else if (e->i_mod != 1)
+			e->i_data2 = e->i_data1;
+		else // If i_mod is 1, operand is (usually) 8 bits rather than 16 bits
+			e->i_data1 = (char)e->i_data1;
+	}
+	e->cycles = instruction_cycles(e);
+}
+
+// Returns the kind of pair an instruction can start. Whether the pair is there is only known when it runs, since the
+// following instruction may not be decoded yet.
+static byte fuse_kind(byte op)
+{
+	if ((op >= 0x38 && op <= 0x3D) || (op >= 0x40 && op <= 0x4F) || (op >= 0x80 && op <= 0x85) || op == 0xA8 || op == 0xA9)
+		return FUSE_JCC;
+	return op == 0xAC || op == 0xAD ? FUSE_STOS : 0;
+}
+
+// Store the current decode fields in the predecoded instruction cache
+static void cache_instruction(vxt_emulator_t *e, decoded_t *d, unsigned addr)
+{
+	d->addr = addr;
+	d->raw_opcode_id = e->raw_opcode_id; d->xlat_opcode_id = e->xlat_opcode_id; d->extra = e->extra;
+	d->i_mod_size = e->i_mod_size; d->set_flags_type = e->set_flags_type;
+	d->i_w = e->i_w; d->i_d = e->i_d; d->i_reg4bit = e->i_reg4bit;
+	d->i_mod = e->i_mod; d->i_rm = e->i_rm; d->i_reg = e->i_reg;
+	d->i_data0 = e->i_data0; d->i_data1 = e->i_data1; d->i_data2 = e->i_data2;
+	d->fuse = fuse_kind(e->raw_opcode_id);
+	d->cycles = e->cycles;
+
+	// Writes to these pages must now check for cached instructions
+	e->code_pages[addr >> CODE_PAGE_SHIFT] |= WATCH_CODE;
+	e->code_pages[(addr + DECODE_SPAN - 1) >> CODE_PAGE_SHIFT] |= WATCH_CODE;
+}
+
+// Load the decode fields from a predecoded instruction
+static void load_instruction(vxt_emulator_t *e, const decoded_t *d)
+{
+	e->raw_opcode_id = d->raw_opcode_id; e->xlat_opcode_id = d->xlat_opcode_id; e->extra = d->extra;
+	e->i_mod_size = d->i_mod_size; e->set_flags_type = d->set_flags_type;
+	e->i_w = d->i_w; e->i_d = d->i_d; e->i_reg4bit = d->i_reg4bit;
+	e->i_data0 = d->i_data0; e->i_data1 = d->i_data1; e->i_data2 = d->i_data2;
+	e->cycles = d->cycles;
+	if (d->i_mod_size)
+		e->i_mod = d->i_mod, e->i_rm = d->i_rm, e->i_reg = d->i_reg;
+}
+
+// Monotonic host time in microseconds
+static unsigned long long host_time_us()
+{
+	#if defined(_WIN32)
+		LARGE_INTEGER freq, count;
+		QueryPerformanceFrequency(&freq);
+		QueryPerformanceCounter(&count);
+		return (unsigned long long)(count.QuadPart / freq.QuadPart) * 1000000 + (unsigned long long)(count.QuadPart % freq.QuadPart) * 1000000 / freq.QuadPart;
+	#else
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (unsigned long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	#endif
+}
+
+// Insert an event into the priority queue (binary min-heap ordered by deadline)
+static void schedule_event(vxt_emulator_t *e, int id, unsigned long long deadline)
+{
+	int i = e->num_events++;
+	for (; i && e->events[(i - 1) / 2].deadline > deadline; i = (i - 1) / 2)
+		e->events[i] = e->events[(i - 1) / 2];
+
+	e->events[i].deadline = deadline;
+	e->events[i].id = id;
+	e->next_event = e->events[0].deadline;
+}
+
+// Remove an event from the priority queue, if it is scheduled
+static void cancel_event(vxt_emulator_t *e, int id)
+{
+	event_t events[MAX_EVENTS];
+	int n = e->num_events;
+	memcpy(events, e->events, sizeof(events));
+	e->num_events = 0;
+	e->next_event = (unsigned long long)-1;
+	for (int i = 0; i < n; i++)
+		events[i].id != id && (schedule_event(e, events[i].id, events[i].deadline), 0);
+}
+
+// Remove and return the earliest event from the priority queue
+static event_t pop_event(vxt_emulator_t *e)
+{
+	event_t top = e->events[0], last = e->events[--e->num_events];
+	int i = 0;
+	for (int c; (c = 2 * i + 1) < e->num_events; i = c)
+	{
+		if (c + 1 < e->num_events && e->events[c + 1].deadline < e->events[c].deadline)
+			c++;
+		if (last.deadline <= e->events[c].deadline)
+			break;
+		e->events[i] = e->events[c];
+	}
+	e->events[i] = last;
+	e->next_event = e->num_events ? e->events[0].deadline : (unsigned long long)-1;
+	return top;
+}
+
+// Number of virtual clock ticks between events occurring at hz times per second
+static unsigned long long event_period(vxt_emulator_t *e, unsigned hz)
+{
+	return e->vclock_freq / hz ? e->vclock_freq / hz : 1;
+}
+
+// Stop the run after this instruction and skip virtual time to the next event, provided an interrupt can end the wait.
+// Returns non-zero if the guest went idle.
+static int go_idle(vxt_emulator_t *e)
+{
+	if (!e->idle_en || !e->regs8[FLAG_IF] || e->regs8[FLAG_TF] || e->pic_pending)
+		return 0;
+	e->idle = 1;
+	e->next_event = e->vclock;
+	return 1;
+}
+
+// Skip virtual time the guest spends waiting. It counts as idle time, so the host sleeps through it.
+static void skip_time(vxt_emulator_t *e, unsigned long long ticks)
+{
+	e->idle_skip += ticks;
+	e->last_poll += ticks;
+	e->last_tick_read += ticks;
+	e->last_retrace_read += ticks;
+	e->vclock += ticks;
+}
+
+// Called before INT 16h. A blocking read of an empty keyboard buffer waits at the INT instruction until a key has
+// arrived, and returns non-zero to hold it there. Repeated empty polls in a tight loop make the guest idle.
+static int keyboard_idle(vxt_emulator_t *e)
+{
+	if (!e->idle_en || load16(e->mem + BDA_KBBUF_HEAD) != load16(e->mem + BDA_KBBUF_TAIL))
+		return 0;
+	if (!e->regs8[REG_AH])
+		return go_idle(e);
+
+	if (e->regs8[REG_AH] == 1)
+	{
+		e->idle_polls = e->vclock - e->last_poll < IDLE_WINDOW(IDLE_POLL_WINDOW) ? e->idle_polls + 1 : 1;
+		e->last_poll = e->vclock;
+		if (e->idle_polls >= IDLE_POLLS)
+			go_idle(e);
+	}
+	return 0;
+}
+
+// Called when an instruction reads the BIOS tick counter. If the same instruction keeps reading the same count with
+// the registers and flags unchanged in between, the loop around it can only be waiting for the next tick.
+static int watch_ticks(vxt_emulator_t *e)
+{
+	if (!e->idle_en)
+		return 0;
+
+	unsigned addr = 16 * e->regs16[REG_CS] + e->reg_ip;
+	sync_flags(e);
+	if (addr == e->tick_addr && e->vclock - e->last_tick_read <= IDLE_WINDOW(IDLE_TICK_WINDOW) && load32(e->mem + BDA_TICKS) == e->tick_value
+		&& !memcmp(e->tick_regs, e->regs8, sizeof(e->tick_regs)) && !memcmp(e->tick_flags, e->regs8 + FLAG_CF, sizeof(e->tick_flags)))
+	{
+		if (++e->tick_polls >= IDLE_TICK_POLLS)
+			go_idle(e);
+	}
+	else
+	{
+		e->tick_polls = 0;
+		e->tick_addr = addr;
+		e->tick_value = load32(e->mem + BDA_TICKS);
+		memcpy(e->tick_regs, e->regs8, sizeof(e->tick_regs));
+		memcpy(e->tick_flags, e->regs8 + FLAG_CF, sizeof(e->tick_flags));
+	}
+	e->last_tick_read = e->vclock;
+	return 0;
 }
 
 // Execute INT #interrupt_num on the emulated machine
@@ -271,15 +901,889 @@ static char pc_interrupt(vxt_emulator_t *e, unsigned char interrupt_num)
 	R_M_PUSH(e->regs16[REG_CS]);
 	R_M_PUSH(e->reg_ip);
 	MEM_OP(REGS_BASE + 2 * REG_CS, =, 4 * interrupt_num + 2);
-	R_M_OP(e->reg_ip, =, e->mem[4 * interrupt_num]);
+	e->reg_ip = load16(e->mem + 4 * interrupt_num);
+
+	return e->regs8[FLAG_TF] = e->regs8[FLAG_IF] = 0;
+}
+
+// AAA and AAS instructions - which_operation is +1 for AAA, and -1 for AAS
+static int AAA_AAS(vxt_emulator_t *e, char which_operation)
+{
+	return (e->regs16[REG_AX] += 262 * which_operation*set_AF(e, set_CF(e, ((e->regs8[REG_AL] & 0x0F) > 9) || e->regs8[FLAG_AF])), e->regs8[REG_AL] &= 0x0F);
+}
+
+// Read a byte or word operand, depending on i_w
+static unsigned read_operand(vxt_emulator_t *e, unsigned addr)
+{
+	return e->i_w ? load16(e->mem + addr) : load8(e->mem + addr);
+}
+
+// Run REP MOVSx (extra=0)|STOSx (extra=1)|LODSx (extra=2) as a single bulk memory operation. Returns zero, leaving the
+// work to the element loop, if SI or DI would wrap within its segment, an operand overlaps the register file, or the
+// copy overlaps itself in the direction it runs.
+static int rep_string_bulk(vxt_emulator_t *e)
+{
+	unsigned n = e->regs16[REG_CX], size = e->i_w + 1, span = (n - 1) * size, len = span + size, down = e->regs8[FLAG_DF];
+	unsigned si = e->regs16[REG_SI], di = e->regs16[REG_DI], use_si = e->extra != 1, use_di = e->extra != 2;
+
+	if (n < 2 || (use_si && (down ? si < span : si + span > 0xFFFF)) || (use_di && (down ? di < span : di + span > 0xFFFF)))
+		return 0;
+
+	// Lowest linear address of each operand, and the element handled last
+	unsigned src = 16 * e->regs16[e->scratch2_uint] + (down ? si - span : si), src_last = down ? src : src + span;
+	unsigned dst = 16 * e->regs16[REG_ES] + (down ? di - span : di), dst_last = down ? dst : dst + span;
+
+	if ((use_si && src < REGS_BASE + REGS_SIZE && src + len > REGS_BASE) || (use_di && dst < REGS_BASE + REGS_SIZE && dst + len > REGS_BASE))
+		return 0;
+	if (!e->extra && dst != src && (dst > src) != down && dst < src + len && src < dst + len)
+		return 0;
+
+	// Leave op_dest/op_source/op_result as the last element would have
+	switch (e->extra)
+	{
+		case 0: // MOVSx
+			e->op_dest = read_operand(e, dst_last);
+			e->op_result = e->op_source = read_operand(e, src_last);
+			memmove(e->mem + dst, e->mem + src, len);
+			watch_write(e, dst, len);
+			break;
+		case 1: // STOSx
+			e->op_dest = read_operand(e, dst_last);
+			e->op_result = e->op_source = read_operand(e, REGS_BASE);
+			if (!e->i_w || e->regs8[REG_AL] == e->regs8[REG_AH])
+				memset(e->mem + dst, e->regs8[REG_AL], len);
+			else for (unsigned i = (store16(e->mem + dst, e->regs16[REG_AX]), size); i < len; i *= 2)
+				memcpy(e->mem + dst + i, e->mem + dst, i < len - i ? i : len - i);
+			watch_write(e, dst, len);
+			break;
+		case 2: // LODSx
+			e->op_dest = read_operand(e, down ? src_last + size : src_last - size);
+			e->op_result = e->op_source = read_operand(e, src_last);
+			e->i_w ? (e->regs16[REG_AX] = e->op_result) : (e->regs8[REG_AL] = e->op_result);
+	}
+
+	use_si && (e->regs16[REG_SI] += down ? -len : len);
+	use_di && (e->regs16[REG_DI] += down ? -len : len);
+	e->regs16[REG_CX] = e->scratch_uint = 0;
+	return 1;
+}
+
+// Processing-order index of the first of n string elements whose comparison ends a REPE/REPNE CMPSx|SCASx, or n if
+// none does. a and b point at the lowest element of each operand, with b zero to compare against AL/AX.
+static unsigned rep_compare_end(vxt_emulator_t *e, const byte *a, const byte *b, unsigned n)
+{
+	unsigned size = e->i_w + 1, len = n * size, down = e->regs8[FLAG_DF], stop_equal = !e->rep_mode, i = 0;
+	byte pattern[16];
+
+	for (int j = 0; j < 16; j++)
+		pattern[j] = e->regs8[REG_AL + (j & e->i_w)];
+
+#ifdef __SSE2__
+	// Compare 16 bytes at a time, from the end of the operands when the direction flag is set
+	__m128i value = _mm_loadu_si128((const __m128i*)pattern);
+	for (; i + 16 <= len; i += 16)
+	{
+		unsigned ofs = down ? len - i - 16 : i;
+		unsigned equal = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(a + ofs)), b ? _mm_loadu_si128((const __m128i*)(b + ofs)) : value));
+		unsigned stop = (e->i_w ? (stop_equal ? equal & equal >> 1 : ~(equal & equal >> 1)) & 0x5555 : (stop_equal ? equal : ~equal) & 0xFFFF);
+
+		if (stop)
+			return down ? n - 1 - (ofs + 31 - __builtin_clz(stop)) / size : (ofs + __builtin_ctz(stop)) / size;
+	}
+#endif
+
+	for (unsigned k = i / size; k < n; k++)
+	{
+		unsigned ofs = (down ? n - 1 - k : k) * size;
+		if ((a[ofs] == (b ? b[ofs] : pattern[0]) && (!e->i_w || a[ofs + 1] == (b ? b[ofs + 1] : pattern[1]))) == stop_equal)
+			return k;
+	}
+	return n;
+}
+
+// Run REPE/REPNE CMPSx (extra=0)|SCASx (extra=1) by scanning for the element that ends it. Returns zero, leaving the
+// work to the element loop, if SI or DI would wrap within its segment or an operand overlaps the register file.
+static int rep_compare_bulk(vxt_emulator_t *e)
+{
+	unsigned n = e->regs16[REG_CX], size = e->i_w + 1, span = (n - 1) * size, len = span + size, down = e->regs8[FLAG_DF];
+	unsigned si = e->regs16[REG_SI], di = e->regs16[REG_DI], use_si = !e->extra;
+
+	if (n < 2 || (use_si && (down ? si < span : si + span > 0xFFFF)) || (down ? di < span : di + span > 0xFFFF))
+		return 0;
+
+	// Lowest linear address of each operand
+	unsigned src = 16 * e->regs16[e->scratch2_uint] + (down ? si - span : si), dst = 16 * e->regs16[REG_ES] + (down ? di - span : di);
+	if ((use_si && src < REGS_BASE + REGS_SIZE && src + len > REGS_BASE) || (dst < REGS_BASE + REGS_SIZE && dst + len > REGS_BASE))
+		return 0;
+
+	unsigned k = use_si ? rep_compare_end(e, e->mem + src, e->mem + dst, n) : rep_compare_end(e, e->mem + dst, 0, n);
+	unsigned count = k < n ? k + 1 : n, step = down ? -size : size;
+
+	// Compare the last element again to leave the operands and flags exactly as the element loop does
+	MEM_OP(use_si ? 16 * e->regs16[e->scratch2_uint] + (unsigned short)(si + (count - 1) * step) : REGS_BASE, -, 16 * e->regs16[REG_ES] + (unsigned short)(di + (count - 1) * step));
+	use_si && (e->regs16[REG_SI] += count * step);
+	e->regs16[REG_DI] += count * step;
+	e->regs16[REG_CX] -= count;
+	e->scratch_uint = 0;
+	e->set_flags_type = FLAGS_UPDATE_SZP | FLAGS_UPDATE_AO_ARITH;
+	set_CF(e, e->op_result > e->op_dest);
+	return 1;
+}
+
+// 8253 PIT
+
+// Advance the PIT clock to the current virtual time
+static void pit_sync(vxt_emulator_t *e)
+{
+	unsigned long long ticks = e->vclock - e->pit_vclock;
+	e->pit_clock += ticks / e->vclock_freq * PIT_FREQ;
+	ticks = ticks % e->vclock_freq * PIT_FREQ + e->pit_frac;
+	e->pit_clock += ticks / e->vclock_freq;
+	e->pit_frac = ticks % e->vclock_freq;
+	e->pit_vclock = e->vclock;
+}
+
+// Current value of a counter. Mode 3 counts down by two, twice per period.
+static word pit_count(vxt_emulator_t *e, pit_channel_t *ch)
+{
+	if (!ch->counting)
+		return (word)ch->reload;
+
+	unsigned long long n = ch->gate ? e->pit_clock - ch->start : ch->held;
+	switch (ch->mode)
+	{
+		case 2: return (word)(ch->reload - n % ch->reload);
+		case 3: return (word)(ch->reload - 2 * (n % ((ch->reload + 1) / 2))) & ~1;
+		default: return (word)(ch->reload - n); // Modes 0, 1, 4 and 5 wrap around and keep counting
+	}
+}
+
+// PIT clock of the next rising edge of a counter output, or PIT_NEVER
+static unsigned long long pit_next_edge(vxt_emulator_t *e, pit_channel_t *ch)
+{
+	if (!ch->counting || !ch->gate)
+		return PIT_NEVER;
+
+	unsigned long long n = e->pit_clock - ch->start;
+	switch (ch->mode)
+	{
+		case 0: case 1: return n < ch->reload ? ch->start + ch->reload : PIT_NEVER; // Terminal count
+		case 2: case 3: return ch->start + (n / ch->reload + 1) * ch->reload; // Every period
+		default: return n <= ch->reload ? ch->start + ch->reload + 1 : PIT_NEVER; // End of the strobe after terminal count
+	}
+}
+
+// Schedule IRQ 0 at the next rising edge of channel 0. The PIT clock must be in sync.
+static void pit_schedule(vxt_emulator_t *e)
+{
+	cancel_event(e, EVENT_TIMER);
+	if ((e->pit_irq = pit_next_edge(e, e->pit)) == PIT_NEVER)
+		return;
+
+	unsigned long long ticks = (e->pit_irq - e->pit_clock) * e->vclock_freq - e->pit_frac;
+	schedule_event(e, EVENT_TIMER, e->vclock + (ticks + PIT_FREQ - 1) / PIT_FREQ);
+}
+
+// Read a counter, or its latched value. A word access mode returns the low byte first.
+static void pit_in(vxt_emulator_t *e, unsigned port)
+{
+	pit_channel_t *ch = e->pit + (port & 3);
+	if (port == 0x43)
+		return;
+
+	pit_sync(e);
+	word count = ch->latched ? ch->latch : pit_count(e, ch);
+	e->io_ports[port] = ch->access == 2 || (ch->access == 3 && ch->read_hi) ? count >> 8 : count & 0xFF;
+	ch->access == 3 && (ch->read_hi ^= 1);
+	ch->read_hi || (ch->latched = 0);
+}
+
+// Control word on port 43h, or a count for one of the counters
+static void pit_out(vxt_emulator_t *e, unsigned port, byte al)
+{
+	pit_channel_t *ch = e->pit + (port == 0x43 ? al >> 6 : port & 3);
+	if (port == 0x43 && al >> 6 == 3) // Read-back exists on the 8254 only
+		return;
+
+	pit_sync(e);
+	if (port == 0x43 && !(al & 0x30))
+	{
+		// Counter latch command
+		ch->latched || (ch->latch = pit_count(e, ch), ch->latched = 1);
+		return;
+	}
+
+	if (port == 0x43)
+	{
+		ch->access = al >> 4 & 3;
+		ch->mode = al >> 1 & 7;
+		ch->mode > 5 && (ch->mode -= 4);
+		ch->reload = ch->counting = ch->latched = ch->write_hi = ch->read_hi = 0;
+		al >> 6 == 2 && e->pause_audio && (e->pause_audio((al & 0xF7) != 0xB6), 0); // Speaker enable
+	}
+	else
+	{
+		if (!ch->access)
+			return;
+
+		// The first byte of a word count stops a mode 0 counter until the second arrives
+		if (ch->access == 3 && (ch->write_hi ^= 1))
+		{
+			ch->write_lsb = al;
+			ch->mode || (ch->counting = 0);
+			return;
+		}
+
+		unsigned count = ch->access == 1 ? al : ch->access == 2 ? al << 8 : ch->write_lsb | al << 8;
+		ch->reload = count ? count : 0x10000;
+		ch->start = e->pit_clock;
+		ch->held = 0;
+		ch->counting = ch->mode != 1 && ch->mode != 5; // Modes 1 and 5 wait for a rising edge on the gate
+	}
+
+	ch == e->pit && (pit_schedule(e), 0);
+}
+
+// Port 61h bit 0 gates counter 2, and bit 1 connects its output to the speaker
+static void speaker_out(vxt_emulator_t *e, unsigned port, byte al)
+{
+	pit_channel_t *ch = e->pit + 2;
+	e->spkr_en |= al & 3;
+	if ((al & 1) == ch->gate)
+		return;
+
+	pit_sync(e);
+	if ((ch->gate = al & 1))
+	{
+		// A rising edge resumes modes 0 and 4, and restarts the count in the other modes
+		ch->start = e->pit_clock - (ch->mode == 0 || ch->mode == 4 ? ch->held : 0);
+		ch->reload && (ch->counting = 1);
+	}
+	else
+	{
+		ch->held = e->pit_clock - ch->start;
+	}
+}
+
+// 8259 PIC
+
+// Pick the highest priority request that is not masked and not blocked by an interrupt in service. IRQ 0 is highest.
+static void pic_update(vxt_emulator_t *e)
+{
+	byte req = e->pic_irr & ~e->pic_imr, bit = req & -req;
+	e->pic_pending = bit && (!e->pic_isr || bit < (e->pic_isr & -e->pic_isr)) ? bit : 0;
+}
+
+// Edge on an interrupt request line
+static void pic_raise(vxt_emulator_t *e, int irq)
+{
+	e->pic_irr |= 1 << irq;
+	pic_update(e);
+}
+
+// Interrupt acknowledge. Moves the pending request into service and returns its vector.
+static byte pic_acknowledge(vxt_emulator_t *e)
+{
+	byte irq = 0, bit = e->pic_pending;
+	while (!(bit & (1 << irq)))
+		irq++;
+
+	e->pic_irr &= ~bit;
+	e->pic_auto_eoi || (e->pic_isr |= bit);
+	pic_update(e);
+	return e->pic_base + irq;
+}
+
+static void pic_in(vxt_emulator_t *e, unsigned port)
+{
+	e->io_ports[port] = port == 0x21 ? e->pic_imr : e->pic_read_isr ? e->pic_isr : e->pic_irr;
+}
+
+// ICW1 and OCW2/OCW3 on port 20h. ICW2-4 and OCW1 (the mask) on port 21h. Rotation and special mask modes are not
+// supported.
+static void pic_out(vxt_emulator_t *e, unsigned port, byte al)
+{
+	if (port == 0x21 && e->pic_init)
+	{
+		e->pic_init == 3 && (e->pic_base = al & 0xF8);
+		e->pic_init == 1 && (e->pic_auto_eoi = al >> 1 & 1);
+		e->pic_init--;
+		e->pic_init == 2 && (e->pic_icw1 & 2) && e->pic_init--; // No ICW3 in single mode
+		e->pic_init == 1 && !(e->pic_icw1 & 1) && e->pic_init--; // No ICW4
+		return;
+	}
+
+	if (port == 0x21)
+		e->pic_imr = al;
+	else if (al & 0x10) // ICW1
+		e->pic_icw1 = al, e->pic_init = 3, e->pic_imr = e->pic_isr = e->pic_read_isr = e->pic_auto_eoi = 0;
+	else if ((al & 0x18) == 0x08) // OCW3
+		al & 2 && (e->pic_read_isr = al & 1);
+	else if (al & 0x20) // OCW2 EOI, specific or for the highest priority interrupt in service
+		e->pic_isr &= ~(al & 0x40 ? 1 << (al & 7) : e->pic_isr & -e->pic_isr);
+
+	pic_update(e);
+}
+
+// Built-in port devices. A read handler updates io_ports[port] before the CPU reads it, a write handler sees the
+// value after it has been stored in io_ports[port].
+
+static void keyboard_in(vxt_emulator_t *e, unsigned port) { e->io_ports[0x64] = 0; } // Scancode read flag
+static void hercules_status_in(vxt_emulator_t *e, unsigned port) { e->io_ports[0x3BA] ^= 0x80; } // Refresh
+
+static void joystick_in(vxt_emulator_t *e, unsigned port)
+{
+	e->io_ports[0x201] = 0;
+	printf("Warning! Reading joystick data directly is not supported!\n");
+}
+
+static void joystick_out(vxt_emulator_t *e, unsigned port, byte al) { printf("Warning! Writing joystick data directly is not supported!\n"); }
+
+// CGA status, as of dot p of a frame. Bit 0 is set outside the visible area and bit 3 during vertical sync.
+static byte cga_status(unsigned p)
+{
+	unsigned line = p / CGA_LINE_DOTS;
+	return (line >= CGA_VISIBLE_LINES || p % CGA_LINE_DOTS >= CGA_VISIBLE_DOTS) | (line - CGA_VSYNC_LINE < CGA_VSYNC_LINES) << 3;
+}
+
+// Dots from p until one of the mask bits of the status changes. Bits only change where a visible line starts or ends.
+static unsigned cga_status_change(unsigned p, byte mask)
+{
+	byte now = cga_status(p) & mask;
+	unsigned q = p;
+	do
+		q += q % CGA_LINE_DOTS < CGA_VISIBLE_DOTS ? CGA_VISIBLE_DOTS - q % CGA_LINE_DOTS : CGA_LINE_DOTS - q % CGA_LINE_DOTS;
+	while ((cga_status(q % CGA_FRAME_DOTS) & mask) == now);
+	return q - p;
+}
+
+// Dot of the frame the raster is at. The frame is timed by the PIT clock, from the same crystal.
+static unsigned cga_dot(vxt_emulator_t *e)
+{
+	pit_sync(e);
+	return (unsigned)(e->pit_clock % (CGA_FRAME_DOTS / CGA_PIT_DOTS)) * CGA_PIT_DOTS + (unsigned)(e->pit_frac * CGA_PIT_DOTS / e->vclock_freq);
+}
+
+// If the same IN keeps reading the same status bits with the other registers and the flags unchanged in between, the
+// loop around it waits for retrace, and virtual time skips to the change it tests for. A TEST or AND of AL followed by
+// a conditional jump back to the IN tells which bits those are, otherwise both count. AL is left out since the IN
+// replaces it.
+static void cga_status_in(vxt_emulator_t *e, unsigned port)
+{
+	unsigned addr = 16 * e->regs16[REG_CS] + e->reg_ip, p = cga_dot(e);
+
+	if (e->idle_en && !e->regs8[FLAG_TF] && !e->trap_flag && !(e->regs8[FLAG_IF] && e->pic_pending) && e->vclock < e->next_event)
+	{
+		byte *next = e->mem + addr + 1, mask = 9;
+		unsigned len = *next == 0xA8 || *next == 0x24 ? 2 : *next == 0xF6 && next[1] == 0xC0 ? 3 : 0; // TEST|AND AL, imm8
+		len && (next[len] & 0xF0) == 0x70 && (char)next[len + 1] == -(int)len - 3 && (mask &= next[len - 1]); // Jcc back to the IN
+
+		sync_flags(e);
+		if (mask && addr == e->retrace_addr && e->vclock - e->last_retrace_read <= IDLE_WINDOW(IDLE_TICK_WINDOW) && !((cga_status(p) ^ e->io_ports[0x3DA]) & mask)
+			&& !memcmp(e->retrace_regs + 1, e->regs8 + 1, sizeof(e->retrace_regs) - 1) && !memcmp(e->retrace_flags, e->regs8 + FLAG_CF, sizeof(e->retrace_flags)))
+		{
+			if (++e->retrace_polls >= IDLE_RETRACE_POLLS)
+			{
+				unsigned long long wait = ((unsigned long long)cga_status_change(p, mask) * e->vclock_freq + CGA_PIT_DOTS * PIT_FREQ - 1) / (CGA_PIT_DOTS * PIT_FREQ);
+				skip_time(e, wait < e->next_event - e->vclock ? wait : e->next_event - e->vclock);
+				p = cga_dot(e);
+				e->retrace_polls = 0;
+			}
+		}
+		else
+		{
+			e->retrace_polls = 0;
+			e->retrace_addr = addr;
+		}
+		memcpy(e->retrace_regs, e->regs8, sizeof(e->retrace_regs));
+		memcpy(e->retrace_flags, e->regs8 + FLAG_CF, sizeof(e->retrace_flags));
+		e->last_retrace_read = e->vclock;
+	}
+	e->io_ports[0x3DA] = cga_status(p);
+}
+
+// CRT cursor position
+static void cga_crtc_in(vxt_emulator_t *e, unsigned port)
+{
+	(e->io_ports[0x3D4] >> 1 == 7) && (e->io_ports[0x3D5] = ((e->mem[0x49E]*80 + e->mem[0x49D] + (short)load16(e->mem + 0x4AD)) & (e->io_ports[0x3D4] & 1 ? 0xFF : 0xFF00)) >> (e->io_ports[0x3D4] & 1 ? 0 : 8));
+}
+
+static void cga_crtc_out(vxt_emulator_t *e, unsigned port, byte al)
+{
+	unsigned pos;
+	(e->io_ports[0x3D4] >> 1 == 6) && (e->mem[0x4AD + !(e->io_ports[0x3D4] & 1)] = al); // Video RAM start offset
+	(e->io_ports[0x3D4] >> 1 == 7) && (pos = ((e->mem[0x49E]*80 + e->mem[0x49D] + (short)load16(e->mem + 0x4AD)) & (e->io_ports[0x3D4] & 1 ? 0xFF00 : 0xFF)) + (al << (e->io_ports[0x3D4] & 1 ? 0 : 8)) - (short)load16(e->mem + 0x4AD), e->mem[0x49D] = pos % 80, e->mem[0x49E] = pos / 80); // Cursor position
+}
+
+// Hercules resolution reprogramming. Defaults are set in the BIOS
+static void hercules_crtc_out(vxt_emulator_t *e, unsigned port, byte al)
+{
+	e->io_ports[0x3B4] == 1 && (e->GRAPHICS_X = al * 16);
+	e->io_ports[0x3B4] == 6 && (e->GRAPHICS_Y = al * 4);
+}
+
+const port_device_t port_devices[PORT_DEVICES] = {
+	{0, 0},								// PORT_NONE
+	{pic_in, pic_out},					// PORT_PIC
+	{pit_in, pit_out},					// PORT_PIT
+	{0, speaker_out},					// PORT_SPEAKER
+	{keyboard_in, 0},					// PORT_KEYBOARD
+	{joystick_in, joystick_out},		// PORT_JOYSTICK
+	{cga_crtc_in, cga_crtc_out},		// PORT_CGA_CRTC
+	{cga_status_in, 0},					// PORT_CGA_STATUS
+	{0, hercules_crtc_out},				// PORT_HERCULES_CRTC
+	{hercules_status_in, 0}				// PORT_HERCULES_STATUS
+};
+
+// Attach a built-in device to the reads and writes of a port it handles
+static void claim_port(vxt_emulator_t *e, unsigned port, byte device)
+{
+	port_devices[device].in && (e->port_in_dev[port] = device);
+	port_devices[device].out && (e->port_out_dev[port] = device);
+}
+
+static void init_ports(vxt_emulator_t *e)
+{
+	claim_port(e, 0x20, PORT_PIC);
+	claim_port(e, 0x21, PORT_PIC);
+	for (unsigned port = 0x40; port <= 0x43; port++)
+		claim_port(e, port, PORT_PIT);
+	claim_port(e, 0x60, PORT_KEYBOARD);
+	claim_port(e, 0x61, PORT_SPEAKER);
+	claim_port(e, 0x201, PORT_JOYSTICK);
+	claim_port(e, 0x3B5, PORT_HERCULES_CRTC);
+	claim_port(e, 0x3BA, PORT_HERCULES_STATUS);
+	claim_port(e, 0x3D5, PORT_CGA_CRTC);
+	claim_port(e, 0x3DA, PORT_CGA_STATUS);
+}
+
+// Read a byte or word from an I/O port. Ports without a device cost a table lookup on top of the io_ports[] access.
+static unsigned port_in(vxt_emulator_t *e, unsigned port, int w)
+{
+	byte dev = e->port_in_dev[port];
+	if (dev)
+	{
+		(dev & ~PORT_MAPPED) && (port_devices[dev & ~PORT_MAPPED].in(e, port), 0);
+		(dev & PORT_MAPPED) && (e->io_ports[port] = e->port_map->in(e->port_map->userdata, port));
+	}
+	return w ? load16(e->io_ports + port) : e->io_ports[port];
+}
+
+// Write a byte or word to an I/O port. Devices only look at the low byte.
+static void port_out(vxt_emulator_t *e, unsigned port, unsigned value, int w)
+{
+	byte al = value, dev = e->port_out_dev[port];
+	w ? store16(e->io_ports + port, value) : (e->io_ports[port] = al);
+	if (dev)
+	{
+		(dev & ~PORT_MAPPED) && (port_devices[dev & ~PORT_MAPPED].out(e, port, al), 0);
+		(dev & PORT_MAPPED) && (e->port_map->out(e->port_map->userdata, port, al), 0);
+	}
+}
+
+// 8087 coprocessor
+
+static void fpu_init(vxt_emulator_t *e)
+{
+	e->fpu_cw = FPU_CW_INIT;
+	e->fpu_sw = e->fpu_top = 0;
+	e->fpu_empty = 0xFF;
+}
+
+static void fpu_exception(vxt_emulator_t *e, int bits)
+{
+	e->fpu_sw |= bits;
+	if (bits & ~e->fpu_cw & FPU_EXCEPTIONS)
+		e->fpu_sw |= FPU_ES;
+}
+
+// Masked response to an invalid operation, the negative quiet NaN the 8087 calls indefinite
+static long double fpu_invalid(vxt_emulator_t *e)
+{
+	fpu_exception(e, FPU_IE);
+	return -(long double)NAN;
+}
+
+// Read ST(i). An empty register is a stack underflow.
+static long double fpu_get(vxt_emulator_t *e, int i)
+{
+	int r = (e->fpu_top + i) & 7;
+	return e->fpu_empty >> r & 1 ? fpu_invalid(e) : e->fpu_st[r];
+}
+
+static void fpu_set(vxt_emulator_t *e, int i, long double v)
+{
+	int r = (e->fpu_top + i) & 7;
+	e->fpu_st[r] = v;
+	e->fpu_empty &= ~(1 << r);
+}
+
+// Pushing onto a full register is a stack overflow
+static void fpu_push(vxt_emulator_t *e, long double v)
+{
+	e->fpu_top = (e->fpu_top - 1) & 7;
+	fpu_set(e, 0, e->fpu_empty >> e->fpu_top & 1 ? v : fpu_invalid(e));
+}
+
+static void fpu_pop(vxt_emulator_t *e)
+{
+	e->fpu_empty |= 1 << e->fpu_top;
+	e->fpu_top = (e->fpu_top + 1) & 7;
+}
+
+// Round to an integer as selected by the RC field of the control word
+static long double fpu_round(vxt_emulator_t *e, long double v)
+{
+	switch (e->fpu_cw >> 10 & 3)
+	{
+		case 0: return nearbyintl(v);
+		case 1: return floorl(v);
+		case 2: return ceill(v);
+		default: return truncl(v);
+	}
+}
+
+// Flag an invalid result, or an overflow to infinity, of an operation on the operands a and b
+static long double fpu_result(vxt_emulator_t *e, long double r, long double a, long double b)
+{
+	if (isnan(r) && !isnan(a) && !isnan(b))
+		return fpu_invalid(e);
+	if (isinf(r) && isfinite(a) && isfinite(b))
+		fpu_exception(e, FPU_OE);
+	return r;
+}
+
+// Set C3/C2/C0 from comparing a to b
+static void fpu_compare(vxt_emulator_t *e, long double a, long double b)
+{
+	e->fpu_sw &= ~FPU_CC;
+	if (isnan(a) || isnan(b))
+		fpu_exception(e, FPU_IE), e->fpu_sw |= FPU_C3 | FPU_C2 | FPU_C0;
+	else
+		e->fpu_sw |= a < b ? FPU_C0 : (a == b ? FPU_C3 : 0);
+}
+
+// FADD|FMUL|FCOM|FCOMP|FSUB|FSUBR|FDIV|FDIVR (op=0-7) of ST(dst) and b, stored in ST(dst)
+static void fpu_arith(vxt_emulator_t *e, int op, int dst, long double b)
+{
+	long double a = fpu_get(e, dst), r;
+	switch (op)
+	{
+		case 0: r = a + b; break;
+		case 1: r = a * b; break;
+		case 2: case 3: fpu_compare(e, a, b); op == 3 && (fpu_pop(e), 0); return;
+		case 4: r = a - b; break;
+		case 5: r = b - a; break;
+		case 6: r = a / b; break;
+		default: r = b / a; break;
+	}
+	if (op > 5 && (op == 6 ? b : a) == 0 && isfinite(op == 6 ? a : b) && (op == 6 ? a : b) != 0)
+		fpu_exception(e, FPU_ZE), fpu_set(e, dst, r);
+	else
+		fpu_set(e, dst, fpu_result(e, r, a, b));
+}
+
+// Convert from and to the 80-bit temporary real format. Exact where long double has a 64-bit significand.
+static long double fpu_load80(const byte *p)
+{
+	unsigned long long mant = load32(p) + ((unsigned long long)load32(p + 4) << 32);
+	int exp = load16(p + 8) & 0x7FFF;
+	long double v = exp == 0x7FFF ? (mant << 1 ? (long double)NAN : (long double)INFINITY) : ldexpl((long double)mant, (exp ? exp : 1) - 16383 - 63);
+	return p[9] & 0x80 ? -v : v;
+}
+
+static void fpu_store80(byte *p, long double v)
+{
+	unsigned long long mant = 0;
+	int exp = 0;
+	if (isnan(v))
+		exp = 0x7FFF, mant = 0xC000000000000000ull;
+	else if (isinf(v))
+		exp = 0x7FFF, mant = 0x8000000000000000ull;
+	else if (v != 0)
+	{
+		frexpl(fabsl(v), &exp);
+		if ((exp += 16382) > 0)
+			mant = (unsigned long long)ldexpl(fabsl(v), 16383 + 63 - exp);
+		else // Denormal
+			mant = (unsigned long long)ldexpl(fabsl(v), 16382 + 63), exp = 0;
+	}
+	store32(p, (unsigned)mant);
+	store32(p + 4, (unsigned)(mant >> 32));
+	store16(p + 8, exp | (signbit(v) ? 0x8000 : 0));
+}
+
+// Load a memory operand in the format given by the MF field of a D8|DA|DC|DE opcode
+static long double fpu_load(vxt_emulator_t *e, int mf, unsigned addr)
+{
+	float f;
+	double d;
+	switch (mf)
+	{
+		case 0: memcpy(&f, e->mem + addr, sizeof(f)); return f;
+		case 1: return (int)load32(e->mem + addr);
+		case 2: memcpy(&d, e->mem + addr, sizeof(d)); return d;
+		default: return (short)load16(e->mem + addr);
+	}
+}
+
+static void fpu_write(vxt_emulator_t *e, unsigned addr, const void *data, unsigned len)
+{
+	memcpy(e->mem + addr, data, len);
+	watch_write(e, addr, len);
+}
+
+// FIST|FISTP of a 16, 32 or 64-bit integer. Out of range values store the integer indefinite.
+static void fpu_store_int(vxt_emulator_t *e, unsigned addr, int len)
+{
+	long double v = fpu_round(e, fpu_get(e, 0)), limit = ldexpl(1, 8 * len - 1);
+	long long n = (long long)-limit;
+	if (isnan(v) || v < -limit || v >= limit)
+		fpu_exception(e, FPU_IE);
+	else
+		n = (long long)v;
+	fpu_write(e, addr, &n, len);
+}
+
+// FBLD|FBSTP of an 18 digit packed BCD integer
+static long double fpu_load_bcd(vxt_emulator_t *e, unsigned addr)
+{
+	long double v = 0;
+	for (int i = 8; i >= 0; i--)
+		v = v * 100 + (e->mem[addr + i] >> 4) * 10 + (e->mem[addr + i] & 15);
+	return e->mem[addr + 9] & 0x80 ? -v : v;
+}
+
+static void fpu_store_bcd(vxt_emulator_t *e, unsigned addr)
+{
+	long double v = fpu_round(e, fpu_get(e, 0));
+	byte bcd[10] = {0, 0, 0, 0, 0, 0, 0, 0xC0, 0xFF, 0xFF};
+	if (isnan(v) || fabsl(v) >= 1e18L)
+		fpu_exception(e, FPU_IE);
+	else
+	{
+		unsigned long long n = (unsigned long long)fabsl(v);
+		for (int i = 0; i < 9; i++, n /= 100)
+			bcd[i] = (byte)(n % 10 + (n / 10 % 10 << 4));
+		bcd[9] = signbit(v) ? 0x80 : 0;
+	}
+	fpu_write(e, addr, bcd, sizeof(bcd));
+}
+
+// FSTENV|FSAVE and FLDENV|FRSTOR in the 14 byte real mode layout. The tag word marks each register valid, zero,
+// special or empty.
+static void fpu_store_env(vxt_emulator_t *e, unsigned addr)
+{
+	byte env[14];
+	word tags = 0;
+	for (int r = 7; r >= 0; r--)
+		tags = tags << 2 | (e->fpu_empty >> r & 1 ? 3 : e->fpu_st[r] == 0 ? 1 : !isnormal(e->fpu_st[r]) ? 2 : 0);
+
+	store16(env, e->fpu_cw);
+	store16(env + 2, (e->fpu_sw & ~FPU_TOP) | e->fpu_top << 11);
+	store16(env + 4, tags);
+	store16(env + 6, e->fpu_ip);
+	store16(env + 8, (e->fpu_ip >> 4 & 0xF000) | e->fpu_op);
+	store16(env + 10, e->fpu_dp);
+	store16(env + 12, e->fpu_dp >> 4 & 0xF000);
+	fpu_write(e, addr, env, sizeof(env));
+}
+
+static void fpu_load_env(vxt_emulator_t *e, unsigned addr)
+{
+	word tags = load16(e->mem + addr + 4);
+	e->fpu_cw = load16(e->mem + addr);
+	e->fpu_sw = load16(e->mem + addr + 2);
+	e->fpu_top = e->fpu_sw >> 11 & 7;
+	e->fpu_empty = 0;
+	for (int r = 0; r < 8; r++)
+		e->fpu_empty |= ((tags >> 2 * r & 3) == 3) << r;
+	e->fpu_ip = load16(e->mem + addr + 6) + ((load16(e->mem + addr + 8) & 0xF000) << 4);
+	e->fpu_op = load16(e->mem + addr + 8) & 0x7FF;
+	e->fpu_dp = load16(e->mem + addr + 10) + ((load16(e->mem + addr + 12) & 0xF000) << 4);
+}
 
-	return e->regs8[FLAG_TF] = e->regs8[FLAG_IF] = 0;
+// FXAM. C1 is the sign, C3/C2/C0 the class of ST.
+static void fpu_examine(vxt_emulator_t *e)
+{
+	long double v = e->fpu_st[e->fpu_top];
+	e->fpu_sw = (e->fpu_sw & ~FPU_CC) | (signbit(v) ? FPU_C1 : 0);
+	if (e->fpu_empty >> e->fpu_top & 1)
+		e->fpu_sw |= FPU_C3 | FPU_C0;
+	else switch (fpclassify(v))
+	{
+		case FP_NAN: e->fpu_sw |= FPU_C0; break;
+		case FP_INFINITE: e->fpu_sw |= FPU_C2 | FPU_C0; break;
+		case FP_ZERO: e->fpu_sw |= FPU_C3; break;
+		case FP_SUBNORMAL: e->fpu_sw |= FPU_C3 | FPU_C2; break;
+		default: e->fpu_sw |= FPU_C2;
+	}
 }
 
-// AAA and AAS instructions - which_operation is +1 for AAA, and -1 for AAS
-static int AAA_AAS(vxt_emulator_t *e, char which_operation)
+// FPREM. The remainder is always complete, so C2 is cleared, and the low three quotient bits go to C0, C3 and C1.
+static void fpu_remainder(vxt_emulator_t *e)
 {
-	return (e->regs16[REG_AX] += 262 * which_operation*set_AF(e, set_CF(e, ((e->regs8[REG_AL] & 0x0F) > 9) || e->regs8[FLAG_AF])), e->regs8[REG_AL] &= 0x0F);
+	long double a = fpu_get(e, 0), b = fpu_get(e, 1), r = fmodl(a, b);
+	int q = isfinite(r) ? (int)(fabsl((fmodl(a, ldexpl(b, 3)) - r) / b) + 0.5L) : 0;
+	e->fpu_sw = (e->fpu_sw & ~FPU_CC) | (q & 4 ? FPU_C0 : 0) | (q & 2 ? FPU_C3 : 0) | (q & 1 ? FPU_C1 : 0);
+	fpu_set(e, 0, fpu_result(e, r, a, b));
+}
+
+// Execute an ESC (D8-DF) instruction, decoded like any other r/m instruction. mod=3 forms operate on ST(i), i=r/m.
+static void fpu_exec(vxt_emulator_t *e)
+{
+	static const long double constants[7] = {
+		1, 3.32192809488736234787031942948939018L, 1.44269504088896340735992468100189214L, 3.14159265358979323846264338327950288L,
+		0.301029995663981195213738894724493027L, 0.693147180559945309417232121458176568L, 0
+	};
+	const int esc = e->raw_opcode_id & 7, op = e->i_reg, i = e->i_rm, mem = e->i_mod < 3;
+	const unsigned addr = e->rm_addr;
+	long double v;
+
+	// Control instructions leave the last instruction and operand pointers alone
+	if (!(mem ? (esc == 1 || esc == 5) && op > 3 : esc == 3 && op == 4))
+	{
+		e->fpu_ip = 16 * e->regs16[REG_CS] + e->reg_ip;
+		e->fpu_op = esc << 8 | (e->i_data0 & 0xFF);
+		mem && (e->fpu_dp = addr);
+	}
+
+	if (!(esc & 1)) // Arithmetic, D8 and DC with ST as the destination. DC and DE register forms swap SUB/SUBR and DIV/DIVR.
+	{
+		if (mem)
+			fpu_arith(e, op, 0, fpu_load(e, esc >> 1, addr));
+		else if (!esc)
+			fpu_arith(e, op, 0, fpu_get(e, i));
+		else if (esc == 6 && op == 3) // FCOMPP
+			i == 1 && (fpu_compare(e, fpu_get(e, 0), fpu_get(e, 1)), fpu_pop(e), fpu_pop(e), 0);
+		else
+			op == 2 || op == 3 ? fpu_arith(e, op, 0, fpu_get(e, i)) : fpu_arith(e, op ^ (op > 3), i, fpu_get(e, 0)),
+			esc == 6 && op != 3 && (fpu_pop(e), 0);
+		return;
+	}
+
+	if (mem) switch (esc << 3 | op)
+	{
+		case 010: fpu_push(e, fpu_load(e, 0, addr)); break; // FLD m32
+		case 030: fpu_push(e, fpu_load(e, 1, addr)); break; // FILD m32
+		case 050: fpu_push(e, fpu_load(e, 2, addr)); break; // FLD m64
+		case 070: fpu_push(e, fpu_load(e, 3, addr)); break; // FILD m16
+		case 035: fpu_push(e, fpu_load80(e->mem + addr)); break; // FLD m80
+		case 074: fpu_push(e, fpu_load_bcd(e, addr)); break; // FBLD
+		case 075: // FILD m64
+		{
+			long long n;
+			memcpy(&n, e->mem + addr, sizeof(n));
+			fpu_push(e, n);
+			break;
+		}
+		case 012: case 013: // FST|FSTP m32
+		{
+			float f = (float)fpu_get(e, 0);
+			fpu_write(e, addr, &f, sizeof(f));
+			op & 1 && (fpu_pop(e), 0);
+			break;
+		}
+		case 052: case 053: // FST|FSTP m64
+		{
+			double d = (double)fpu_get(e, 0);
+			fpu_write(e, addr, &d, sizeof(d));
+			op & 1 && (fpu_pop(e), 0);
+			break;
+		}
+		case 037: // FSTP m80
+		{
+			byte t[10];
+			fpu_store80(t, fpu_get(e, 0));
+			fpu_write(e, addr, t, sizeof(t));
+			fpu_pop(e);
+			break;
+		}
+		case 032: case 033: fpu_store_int(e, addr, 4); op & 1 && (fpu_pop(e), 0); break; // FIST|FISTP m32
+		case 072: case 073: fpu_store_int(e, addr, 2); op & 1 && (fpu_pop(e), 0); break; // FIST|FISTP m16
+		case 077: fpu_store_int(e, addr, 8); fpu_pop(e); break; // FISTP m64
+		case 076: fpu_store_bcd(e, addr); fpu_pop(e); break; // FBSTP
+		case 014: fpu_load_env(e, addr); break; // FLDENV
+		case 015: e->fpu_cw = load16(e->mem + addr); break; // FLDCW
+		case 016: fpu_store_env(e, addr); break; // FSTENV
+		case 017: fpu_write(e, addr, &e->fpu_cw, 2); break; // FSTCW
+		case 054: // FRSTOR
+			fpu_load_env(e, addr);
+			for (int r = 0; r < 8; r++)
+				e->fpu_st[(e->fpu_top + r) & 7] = fpu_load80(e->mem + addr + 14 + 10 * r);
+			break;
+		case 056: // FSAVE
+		{
+			byte t[10];
+			fpu_store_env(e, addr);
+			for (int r = 0; r < 8; r++)
+				fpu_store80(t, e->fpu_st[(e->fpu_top + r) & 7]), fpu_write(e, addr + 14 + 10 * r, t, sizeof(t));
+			fpu_init(e);
+			break;
+		}
+		case 057: // FSTSW
+		{
+			word sw = (e->fpu_sw & ~FPU_TOP) | e->fpu_top << 11;
+			fpu_write(e, addr, &sw, 2);
+		}
+	}
+	else switch (esc << 3 | op)
+	{
+		case 010: v = fpu_get(e, i); fpu_push(e, v); break; // FLD ST(i)
+		case 011: v = fpu_get(e, 0); fpu_set(e, 0, fpu_get(e, i)); fpu_set(e, i, v); break; // FXCH
+		case 013: case 052: case 053: fpu_set(e, i, fpu_get(e, 0)); op & 1 && (fpu_pop(e), 0); break; // FST|FSTP ST(i)
+		case 050: e->fpu_empty |= 1 << ((e->fpu_top + i) & 7); break; // FFREE
+		case 014:
+			switch (i)
+			{
+				case 0: fpu_set(e, 0, -fpu_get(e, 0)); break; // FCHS
+				case 1: fpu_set(e, 0, fabsl(fpu_get(e, 0))); break; // FABS
+				case 4: fpu_compare(e, fpu_get(e, 0), 0); break; // FTST
+				case 5: fpu_examine(e); // FXAM
+			}
+			break;
+		case 015: i < 7 && (fpu_push(e, constants[i]), 0); break; // FLD1|FLDL2T|FLDL2E|FLDPI|FLDLG2|FLDLN2|FLDZ
+		case 016:
+			switch (i)
+			{
+				case 0: v = fpu_get(e, 0); fpu_set(e, 0, fpu_result(e, expm1l(v * constants[5]), v, 0)); break; // F2XM1
+				case 1: v = fpu_get(e, 0); fpu_set(e, 1, fpu_result(e, fpu_get(e, 1) * log2l(v), v, 1)); fpu_pop(e); break; // FYL2X
+				case 2: v = fpu_get(e, 0); fpu_set(e, 0, fpu_result(e, tanl(v), v, 0)); fpu_push(e, 1); break; // FPTAN
+				case 3: v = fpu_get(e, 0); fpu_set(e, 1, fpu_result(e, atan2l(fpu_get(e, 1), v), v, 1)); fpu_pop(e); break; // FPATAN
+				case 4: // FXTRACT, ST(1) gets the exponent and ST the significand
+				{
+					int exp = 0;
+					long double m = isfinite(v = fpu_get(e, 0)) ? 2 * frexpl(v, &exp) : v;
+					v == 0 && (fpu_exception(e, FPU_ZE), 0);
+					fpu_set(e, 0, v == 0 ? -INFINITY : isfinite(v) ? exp - 1 : v);
+					fpu_push(e, m);
+					break;
+				}
+				case 6: e->fpu_top = (e->fpu_top - 1) & 7; break; // FDECSTP
+				case 7: e->fpu_top = (e->fpu_top + 1) & 7; // FINCSTP
+			}
+			break;
+		case 017:
+			switch (i)
+			{
+				case 0: fpu_remainder(e); break; // FPREM
+				case 1: v = fpu_get(e, 0); fpu_set(e, 1, fpu_result(e, fpu_get(e, 1) * log1pl(v) * constants[2], v, 1)); fpu_pop(e); break; // FYL2XP1
+				case 2: v = fpu_get(e, 0); fpu_set(e, 0, fpu_result(e, sqrtl(v), v, 0)); break; // FSQRT
+				case 4: fpu_set(e, 0, fpu_round(e, fpu_get(e, 0))); break; // FRNDINT
+				case 5: // FSCALE
+					v = truncl(fpu_get(e, 1));
+					fpu_set(e, 0, ldexpl(fpu_get(e, 0), v < -65536 ? -65536 : v > 65536 ? 65536 : (int)v));
+			}
+			break;
+		case 034:
+			switch (i)
+			{
+				case 0: e->fpu_cw &= ~FPU_IEM; break; // FENI
+				case 1: e->fpu_cw |= FPU_IEM; break; // FDISI
+				case 2: e->fpu_sw &= ~(FPU_EXCEPTIONS | FPU_ES | 0x8000); break; // FCLEX
+				case 3: fpu_init(e); // FINIT
+			}
+	}
 }
 
 static void emuctl_service(vxt_emulator_t *e, byte service)
@@ -297,6 +1801,7 @@ static void emuctl_service(vxt_emulator_t *e, byte service)
 		}
 		case 2: // Turn on screen.
 			e->screen_off = 0;
+			e->video_full = 1;
 	}
 }
 
@@ -305,14 +1810,24 @@ vxt_emulator_t *vxt_open(vxt_video_t *video, vxt_clock_t *clk, void *mem)
 	vxt_emulator_t *e = (vxt_emulator_t*)mem;
 	if (!e) { e = (vxt_emulator_t*)calloc(1, sizeof(vxt_emulator_t)); e->mem_block = e; } else memset(e, 0, sizeof(vxt_emulator_t));
 	e->clock = clk; e->video = video;
-	e->kb_timer = e->video_timer = clock();
+	e->vclock_freq = DEFAULT_VCLOCK_FREQ;
+	e->sync_time = host_time_us();
+	schedule_event(e, EVENT_KEYBOARD, event_period(e, 100));
+	schedule_event(e, EVENT_VIDEO, event_period(e, 60));
 	e->video_mode = 0xFF;
-
-	// regs16 and reg8 point to F000:0, the start of memory-mapped registers. CS is initialised to F000
+	for (unsigned page = VIDEO_RAM_BASE >> CODE_PAGE_SHIFT; page < (VIDEO_RAM_BASE + VIDEO_RAM_SIZE) >> CODE_PAGE_SHIFT; page++)
+		e->code_pages[page] = WATCH_VIDEO;
+	e->pit[0].gate = e->pit[1].gate = 1;
+	e->pic_base = 8;
+	e->pic_imr = 0xFF;
+	init_ports(e);
+
+	// regs16 and reg8 point to the memory-mapped registers, just past guest memory. CS is initialised to F000
 	e->regs16 = (unsigned short *)(e->regs8 = e->mem + REGS_BASE);
 	e->regs16[REG_CS] = 0xF000;
 	e->regs8[FLAG_TF] = 0; // Trap flag off
 	e->regs8[REG_DL] = 0; // Set DL equal to the boot device: 0 for the FD, or 0x80 for the HD. Normally, boot from the FD.
+	fpu_init(e);
 
 	// Load BIOS image
 	vxt_load_bios(e, bios_bin, sizeof(bios_bin));
@@ -323,21 +1838,30 @@ vxt_emulator_t *vxt_open(vxt_video_t *video, vxt_clock_t *clk, void *mem)
 void vxt_audio_callback(vxt_emulator_t *e, unsigned char *stream, int len)
 {
 	for (int i = 0; i < len; i++)
-		stream[i] = (e->spkr_en == 3) && CAST(unsigned short)e->mem[0x4AA] ? -((54 * e->wave_counter++ / CAST(unsigned short)e->mem[0x4AA]) & 1) : e->audio_silence;
+		stream[i] = (e->spkr_en == 3) && e->pit[2].reload ? -((54 * e->wave_counter++ / e->pit[2].reload) & 1) : e->audio_silence;
 	e->spkr_en = e->io_ports[0x61] & 3;
 }
 
+// Drop all predecoded instructions and blocks
+static void flush_code(vxt_emulator_t *e)
+{
+	memset(e->decode_cache, 0xFF, sizeof(e->decode_cache));
+	for (int i = 0; i < BLOCK_CACHE_SIZE; i++)
+		e->block_cache[i].addr = NO_DECODE;
+}
+
 void vxt_load_bios(vxt_emulator_t *e, const void *data, size_t sz)
 {
 	// Load BIOS image into F000:0100, and set IP to 0100
-	word *dst = (word*)(e->regs8 + (e->reg_ip = 0x100));
+	byte *dst = e->mem + BIOS_BASE + (e->reg_ip = 0x100);
 	memcpy(dst, data, sz < 0xFF00 ? sz : 0xFF00);
-	e->font = e->regs8 + dst[1];
+	flush_code(e);
+	e->font = e->mem + BIOS_BASE + load16(dst + 2);
 }
 
 void vxt_set_harddrive(vxt_emulator_t *e, vxt_drive_t *hd) {
 	// Set CX:AX equal to the hard disk image size
-	CAST(unsigned)e->regs16[REG_AX] = hd->seek(hd->userdata, 0, 2) >> 9;
+	store32(e->regs8 + 2 * REG_AX, hd->seek(hd->userdata, 0, 2) >> 9);
 	e->regs8[REG_DL] = hd->boot || !e->disk[1] ? 0x80 : 0;
 	e->disk[0] = hd;
 }
@@ -350,55 +1874,61 @@ void vxt_replace_floppy(vxt_emulator_t *e, vxt_drive_t *fd) {
 }
 
 void vxt_set_audio_control(vxt_emulator_t *e, vxt_pause_audio_t ac, byte silence) { e->pause_audio = ac; e->audio_silence = silence; }
-void vxt_set_port_map(vxt_emulator_t *e, vxt_port_map_t *map) { e->port_map = map; }
+
+// The filter is asked once per port here, so the CPU can dispatch mapped ports without calling it
+void vxt_set_port_map(vxt_emulator_t *e, vxt_port_map_t *map)
+{
+	e->port_map = map;
+	for (unsigned port = 0; port < IO_PORT_COUNT; port++)
+	{
+		e->port_in_dev[port] = (e->port_in_dev[port] & ~PORT_MAPPED) | (map && map->filter(map->userdata, port, 0) ? PORT_MAPPED : 0);
+		e->port_out_dev[port] = (e->port_out_dev[port] & ~PORT_MAPPED) | (map && map->filter(map->userdata, port, 1) ? PORT_MAPPED : 0);
+	}
+}
+
 void vxt_set_serial(vxt_emulator_t *e, int port, vxt_serial_t *com) { e->serial[port-1] = com; }
 void vxt_set_joystick(vxt_emulator_t *e, vxt_joystick_t *stick) { e->joystick = stick; }
-void vxt_set_screen(vxt_emulator_t *e, int enable) { e->screen_off = enable == 0; }
+void vxt_raise_irq(vxt_emulator_t *e, int irq) { pic_raise(e, irq & 7); }
+void vxt_set_screen(vxt_emulator_t *e, int enable) { e->screen_off = enable == 0; e->video_full = 1; }
+void vxt_set_core(vxt_emulator_t *e, vxt_core_t core) { e->core = core; }
+void vxt_set_cpu(vxt_emulator_t *e, vxt_cpu_t cpu) { e->cpu = cpu; flush_code(e); }
+void vxt_set_frequency(vxt_emulator_t *e, unsigned hz) { if ((e->fixed_freq = hz)) e->vclock_freq = hz; }
+void vxt_set_cycle_timing(vxt_emulator_t *e, int enable) { e->cycle_timing = enable; }
+void vxt_set_idle(vxt_emulator_t *e, int enable) { e->idle_en = enable; }
+unsigned vxt_idle_time(vxt_emulator_t *e) { return (unsigned)(e->idle_skip * 1000000 / e->vclock_freq); }
+unsigned vxt_run_time(vxt_emulator_t *e) { return (unsigned)((e->vclock - e->run_vclock) * 1000000 / e->vclock_freq); }
 void vxt_close(vxt_emulator_t *e) { if (e->mem_block) free(e->mem_block); }
 int vxt_blink(vxt_emulator_t *e) { return e->blink; }
 size_t vxt_memory_required() { return sizeof(vxt_emulator_t); }
 const char *vxt_version() { return VERSION_STRING; }
 
-int vxt_step(vxt_emulator_t *e)
+// Set up variables to prepare for executing the instruction at CS:IP, and skip decoding if the instruction is cached
+static decoded_t *fetch_instruction(vxt_emulator_t *e)
 {
-	// We have no boot media!
-	if (!e->disk[0] && !e->disk[1]) return 0;
+	unsigned addr = 16 * e->regs16[REG_CS] + e->reg_ip;
+	decoded_t *d = &e->decode_cache[addr & (DECODE_CACHE_SIZE - 1)];
+	e->opcode_stream = e->mem + addr;
 
-	// Set up variables to prepare for decoding an opcode
-	e->opcode_stream = e->mem + 16 * e->regs16[REG_CS] + e->reg_ip;
-	set_opcode(e, *e->opcode_stream);
-
-	// Extract i_w and i_d fields from instruction
-	e->i_w = (e->i_reg4bit = e->raw_opcode_id & 7) & 1;
-	e->i_d = e->i_reg4bit / 2 & 1;
-
-	// Extract instruction data fields
-	e->i_data0 = CAST(short)e->opcode_stream[1];
-	e->i_data1 = CAST(short)e->opcode_stream[2];
-	e->i_data2 = CAST(short)e->opcode_stream[3];
+	if (d->addr == addr)
+		load_instruction(e, d);
+	else
+		decode_instruction(e),
+		cache_instruction(e, d, addr);
+	return d;
+}
 
+// Execute the currently decoded instruction. Returns zero if the guest requested shutdown.
+static int exec_instruction(vxt_emulator_t *e)
+{
 	// seg_override_en and rep_override_en contain number of instructions to hold segment override and REP prefix respectively
 	if (e->seg_override_en)
 		e->seg_override_en--;
 	if (e->rep_override_en)
 		e->rep_override_en--;
 
-	// i_mod_size > 0 indicates that opcode uses i_mod/i_rm/i_reg, so decode them
+	// Resolve r/m operand addresses, these depend on the current register values
 	if (e->i_mod_size)
-	{
-		e->i_mod = (e->i_data0 & 0xFF) >> 6;
-		e->i_rm = e->i_data0 & 7;
-		e->i_reg = e->i_data0 / 8 & 7;
-
-		if ((!e->i_mod && e->i_rm == 6) || (e->i_mod == 2))
-			e->i_data2 = CAST(short)e->opcode_stream[4];
-		else if (e->i_mod != 1)
-			e->i_data2 = e->i_data1;
-		else // If i_mod is 1, operand is (usually) 8 bits rather than 16 bits
-			e->i_data1 = (char)e->i_data1;
-
 		DECODE_RM_REG;
-	}
 
 	// Instruction execution unit
 	switch (e->xlat_opcode_id)
@@ -406,10 +1936,12 @@ int vxt_step(vxt_emulator_t *e)
 		OPCODE_CHAIN 0: // Conditional jump (JAE, JNAE, etc.)
 			// i_w is the invert flag, e.g. i_w == 1 means JNAE, whereas i_w == 0 means JAE 
 			e->scratch_uchar = e->raw_opcode_id / 2 & 7;
-			e->reg_ip += (char)e->i_data0 * (e->i_w ^ (e->regs8[decode_lookup[TABLE_COND_JUMP_DECODE_A][e->scratch_uchar]] || e->regs8[decode_lookup[TABLE_COND_JUMP_DECODE_B][e->scratch_uchar]] || e->regs8[decode_lookup[TABLE_COND_JUMP_DECODE_C][e->scratch_uchar]] ^ e->regs8[decode_lookup[TABLE_COND_JUMP_DECODE_D][e->scratch_uchar]]))
+			e->scratch_uint = e->i_w ^ (get_flag(e, decode_lookup[TABLE_COND_JUMP_DECODE_A][e->scratch_uchar]) || get_flag(e, decode_lookup[TABLE_COND_JUMP_DECODE_B][e->scratch_uchar]) || get_flag(e, decode_lookup[TABLE_COND_JUMP_DECODE_C][e->scratch_uchar]) ^ get_flag(e, decode_lookup[TABLE_COND_JUMP_DECODE_D][e->scratch_uchar]));
+			e->reg_ip += (char)e->i_data0 * e->scratch_uint;
+			e->cycles += JUMP_CYCLES * e->scratch_uint
 		OPCODE 1: // MOV reg, imm
 			e->i_w = !!(e->raw_opcode_id & 8);
-			R_M_OP(e->mem[GET_REG_ADDR(e->i_reg4bit)], =, e->i_data0)
+			R_M_OP(GET_REG_ADDR(e->i_reg4bit), =, e->i_data0)
 		OPCODE 3: // PUSH regs16
 			R_M_PUSH(e->regs16[e->i_reg4bit])
 		OPCODE 4: // POP regs16
@@ -422,7 +1954,7 @@ int vxt_step(vxt_emulator_t *e)
 			e->i_reg = e->extra
 		OPCODE_CHAIN 5: // INC|DEC|JMP|CALL|PUSH
 			if (e->i_reg < 2) // INC|DEC
-				MEM_OP(e->op_from_addr, += 1 - 2 * e->i_reg +, REGS_BASE + 2 * REG_ZERO),
+				MEM_OP_W(e->op_from_addr, += 1 - 2 * e->i_reg +, REGS_BASE + 2 * REG_ZERO),
 				e->op_source = 1,
 				set_AF_OF_arith(e),
 				set_OF(e, e->op_dest + 1 - e->i_reg == 1 << (TOP_BIT - 1)),
@@ -430,11 +1962,11 @@ int vxt_step(vxt_emulator_t *e)
 			else if (e->i_reg != 6) // JMP|CALL
 				e->i_reg - 3 || R_M_PUSH(e->regs16[REG_CS]), // CALL (far)
 				e->i_reg & 2 && R_M_PUSH(e->reg_ip + 2 + e->i_mod*(e->i_mod != 3) + 2*(!e->i_mod && e->i_rm == 6)), // CALL (near or far)
-				e->i_reg & 1 && (e->regs16[REG_CS] = CAST(short)e->mem[e->op_from_addr + 2]), // JMP|CALL (far)
-				R_M_OP(e->reg_ip, =, e->mem[e->op_from_addr]),
+				e->i_reg & 1 && (e->regs16[REG_CS] = load16(e->mem + e->op_from_addr + 2)), // JMP|CALL (far)
+				e->reg_ip = load16(e->mem + e->op_from_addr),
 				set_opcode(e, 0x9A); // Decode like CALL
 			else // PUSH
-				R_M_PUSH(e->mem[e->rm_addr])
+				R_M_PUSH(load16(e->mem + e->rm_addr))
 		OPCODE 6: // TEST r/m, imm16 / NOT|NEG|MUL|IMUL|DIV|IDIV reg
 			e->op_to_addr = e->op_from_addr;
 
@@ -443,11 +1975,11 @@ int vxt_step(vxt_emulator_t *e)
 				OPCODE_CHAIN 0: // TEST
 					set_opcode(e, 0x20); // Decode like AND
 					e->reg_ip += e->i_w + 1;
-					R_M_OP(e->mem[e->op_to_addr], &, e->i_data2)
+					R_M_OP(e->op_to_addr, &, e->i_data2)
 				OPCODE 2: // NOT
-					OP(=~)
+					OP_W(=~)
 				OPCODE 3: // NEG
-					OP(=-);
+					OP_W(=-);
 					e->op_dest = 0;
 					set_opcode(e, 0x28); // Decode like SUB
 					set_CF(e, e->op_result > e->op_dest)
@@ -476,48 +2008,49 @@ int vxt_step(vxt_emulator_t *e)
 			switch (e->extra)
 			{
 				OPCODE_CHAIN 0: // ADD
-					OP(+=),
+					OP_W(+=),
 					set_CF(e, e->op_result < e->op_dest)
 				OPCODE 1: // OR
-					OP(|=)
+					OP_W(|=)
 				OPCODE 2: // ADC
 					ADC_SBB_MACRO(+)
 				OPCODE 3: // SBB
 					ADC_SBB_MACRO(-)
 				OPCODE 4: // AND
-					OP(&=)
+					OP_W(&=)
 				OPCODE 5: // SUB
-					OP(-=),
+					OP_W(-=),
 					set_CF(e, e->op_result > e->op_dest)
 				OPCODE 6: // XOR
-					OP(^=)
+					OP_W(^=)
 				OPCODE 7: // CMP
 					OP(-),
 					set_CF(e, e->op_result > e->op_dest)
 				OPCODE 8: // MOV
-					OP(=);
+					OP_W(=);
 			}
 		OPCODE 10: // MOV sreg, r/m | POP r/m | LEA reg, r/m
 			if (!e->i_w) // MOV
 				e->i_w = 1,
 				e->i_reg += 8,
 				DECODE_RM_REG,
-				OP(=);
+				OP_W(=);
 			else if (!e->i_d) // LEA
 				e->seg_override_en = 1,
 				e->seg_override = REG_ZERO,
 				DECODE_RM_REG,
-				R_M_OP(e->mem[e->op_from_addr], =, e->rm_addr);
+				R_M_OP(e->op_from_addr, =, e->rm_addr);
 			else // POP
-				R_M_POP(e->mem[e->rm_addr])
+				store16(e->mem + e->rm_addr, R_M_POP(e->scratch_uint)),
+				CODE_WRITE(e->rm_addr)
 		OPCODE 11: // MOV AL/AX, [loc]
 			e->i_mod = e->i_reg = 0;
 			e->i_rm = 6;
 			e->i_data1 = e->i_data0;
 			DECODE_RM_REG;
-			MEM_OP(e->op_from_addr, =, e->op_to_addr)
+			MEM_OP_W(e->op_from_addr, =, e->op_to_addr)
 		OPCODE 12: // ROL|ROR|RCL|RCR|SHL|SHR|???|SAR reg/mem, 1/CL/imm (80186)
-			e->scratch2_uint = SIGN_OF(e->mem[e->rm_addr]),
+			e->scratch2_uint = SIGN_OF(read_operand(e, e->rm_addr)),
 			e->scratch_uint = e->extra ? // xxx reg/mem, imm
 				++e->reg_ip,
 				(char)e->i_data1
@@ -526,15 +2059,16 @@ int vxt_step(vxt_emulator_t *e)
 					? 31 & e->regs8[REG_CL]
 			: // xxx reg/mem, 1
 				1;
+			e->cycles += (e->extra || e->i_d) * (e->cpu == VXT_CPU_V20 ? 1 : 4) * e->scratch_uint;
 			if (e->scratch_uint)
 			{
 				if (e->i_reg < 4) // Rotate operations
 					e->scratch_uint %= e->i_reg / 2 + TOP_BIT,
-					R_M_OP(e->scratch2_uint, =, e->mem[e->rm_addr]);
+					e->scratch2_uint = read_operand(e, e->rm_addr);
 				if (e->i_reg & 1) // Rotate/shift right operations
-					R_M_OP(e->mem[e->rm_addr], >>=, e->scratch_uint);
+					R_M_OP(e->rm_addr, >>=, e->scratch_uint);
 				else // Rotate/shift left operations
-					R_M_OP(e->mem[e->rm_addr], <<=, e->scratch_uint);
+					R_M_OP(e->rm_addr, <<=, e->scratch_uint);
 				if (e->i_reg > 3) // Shift operations
 					set_opcode(e, 0x10); // Decode like ADC
 				if (e->i_reg > 4) // SHR or SAR
@@ -544,17 +2078,17 @@ int vxt_step(vxt_emulator_t *e)
 			switch (e->i_reg)
 			{
 				OPCODE_CHAIN 0: // ROL
-					R_M_OP(e->mem[e->rm_addr], += , e->scratch2_uint >> (TOP_BIT - e->scratch_uint));
+					R_M_OP(e->rm_addr, += , e->scratch2_uint >> (TOP_BIT - e->scratch_uint));
 					set_OF(e, SIGN_OF(e->op_result) ^ set_CF(e, e->op_result & 1))
 				OPCODE 1: // ROR
 					e->scratch2_uint &= (1 << e->scratch_uint) - 1,
-					R_M_OP(e->mem[e->rm_addr], += , e->scratch2_uint << (TOP_BIT - e->scratch_uint));
+					R_M_OP(e->rm_addr, += , e->scratch2_uint << (TOP_BIT - e->scratch_uint));
 					set_OF(e, SIGN_OF(e->op_result * 2) ^ set_CF(e, SIGN_OF(e->op_result)))
 				OPCODE 2: // RCL
-					R_M_OP(e->mem[e->rm_addr], += (e->regs8[FLAG_CF] << (e->scratch_uint - 1)) + , e->scratch2_uint >> (1 + TOP_BIT - e->scratch_uint));
+					R_M_OP(e->rm_addr, += (e->regs8[FLAG_CF] << (e->scratch_uint - 1)) + , e->scratch2_uint >> (1 + TOP_BIT - e->scratch_uint));
 					set_OF(e, SIGN_OF(e->op_result) ^ set_CF(e, e->scratch2_uint & 1 << (TOP_BIT - e->scratch_uint)))
 				OPCODE 3: // RCR
-					R_M_OP(e->mem[e->rm_addr], += (e->regs8[FLAG_CF] << (TOP_BIT - e->scratch_uint)) + , e->scratch2_uint << (1 + TOP_BIT - e->scratch_uint));
+					R_M_OP(e->rm_addr, += (e->regs8[FLAG_CF] << (TOP_BIT - e->scratch_uint)) + , e->scratch2_uint << (1 + TOP_BIT - e->scratch_uint));
 					set_CF(e, e->scratch2_uint & 1 << (e->scratch_uint - 1));
 					set_OF(e, SIGN_OF(e->op_result) ^ SIGN_OF(e->op_result * 2))
 				OPCODE 4: // SHL
@@ -564,21 +2098,23 @@ int vxt_step(vxt_emulator_t *e)
 				OPCODE 7: // SAR
 					e->scratch_uint < TOP_BIT || set_CF(e, e->scratch2_uint);
 					set_OF(e, 0);
-					R_M_OP(e->mem[e->rm_addr], +=, e->scratch2_uint *= ~(((1 << TOP_BIT) - 1) >> e->scratch_uint));
+					R_M_OP(e->rm_addr, +=, e->scratch2_uint *= ~(((1 << TOP_BIT) - 1) >> e->scratch_uint));
 			}
+			CODE_WRITE(e->rm_addr)
 		OPCODE 13: // LOOPxx|JCZX
 			e->scratch_uint = !!--e->regs16[REG_CX];
 
 			switch(e->i_reg4bit)
 			{
 				OPCODE_CHAIN 0: // LOOPNZ
-					e->scratch_uint &= !e->regs8[FLAG_ZF]
+					e->scratch_uint &= !get_flag(e, FLAG_ZF)
 				OPCODE 1: // LOOPZ
-					e->scratch_uint &= e->regs8[FLAG_ZF]
+					e->scratch_uint &= get_flag(e, FLAG_ZF)
 				OPCODE 3: // JCXXZ
 					e->scratch_uint = !++e->regs16[REG_CX];
 			}
-			e->reg_ip += e->scratch_uint*(char)e->i_data0
+			e->reg_ip += e->scratch_uint*(char)e->i_data0;
+			e->cycles += JUMP_CYCLES * e->scratch_uint
 		OPCODE 14: // JMP | CALL short/near
 			e->reg_ip += 3 - e->i_d;
 			if (!e->i_w)
@@ -598,15 +2134,19 @@ int vxt_step(vxt_emulator_t *e)
 			e->op_from_addr = GET_REG_ADDR(e->i_reg4bit);
 		OPCODE_CHAIN 24: // NOP|XCHG reg, r/m
 			if (e->op_to_addr != e->op_from_addr)
-				OP(^=),
-				MEM_OP(e->op_from_addr, ^=, e->op_to_addr),
-				OP(^=)
+				OP_W(^=),
+				MEM_OP_W(e->op_from_addr, ^=, e->op_to_addr),
+				OP_W(^=)
 		OPCODE 17: // MOVSx (extra=0)|STOSx (extra=1)|LODSx (extra=2)
 			e->scratch2_uint = e->seg_override_en ? e->seg_override : REG_DS;
+			e->rep_override_en && (e->cycles = REP_CYCLES + e->cycles * e->regs16[REG_CX]);
+
+			if (e->rep_override_en && rep_string_bulk(e))
+				break;
 
 			for (e->scratch_uint = e->rep_override_en ? e->regs16[REG_CX] : 1; e->scratch_uint; e->scratch_uint--)
 			{
-				MEM_OP(e->extra < 2 ? SEGREG(REG_ES, REG_DI,) : REGS_BASE, =, e->extra & 1 ? REGS_BASE : SEGREG(e->scratch2_uint, REG_SI,)),
+				MEM_OP_W(e->extra < 2 ? SEGREG(REG_ES, REG_DI,) : REGS_BASE, =, e->extra & 1 ? REGS_BASE : SEGREG(e->scratch2_uint, REG_SI,)),
 				e->extra & 1 || INDEX_INC(REG_SI),
 				e->extra & 2 || INDEX_INC(REG_DI);
 			}
@@ -615,6 +2155,14 @@ int vxt_step(vxt_emulator_t *e)
 				e->regs16[REG_CX] = 0
 		OPCODE 18: // CMPSx (extra=0)|SCASx (extra=1)
 			e->scratch2_uint = e->seg_override_en ? e->seg_override : REG_DS;
+			e->scratch_int = e->cycles; // Charge every element, then refund those a REPE/REPNE left in CX
+			e->rep_override_en && (e->cycles = REP_CYCLES + e->cycles * e->regs16[REG_CX]);
+
+			if (e->rep_override_en && rep_compare_bulk(e))
+			{
+				e->cycles -= e->scratch_int * e->regs16[REG_CX];
+				break;
+			}
 
 			if ((e->scratch_uint = e->rep_override_en ? e->regs16[REG_CX] : 1))
 			{
@@ -624,6 +2172,7 @@ int vxt_step(vxt_emulator_t *e)
 					e->extra || INDEX_INC(REG_SI),
 					INDEX_INC(REG_DI), e->rep_override_en && !(--e->regs16[REG_CX] && ((!e->op_result) == e->rep_mode)) && (e->scratch_uint = 0);
 				}
+				e->rep_override_en && (e->cycles -= e->scratch_int * e->regs16[REG_CX]);
 
 				e->set_flags_type = FLAGS_UPDATE_SZP | FLAGS_UPDATE_AO_ARITH; // Funge to set SZP/AO flags
 				set_CF(e, e->op_result > e->op_dest);
@@ -638,30 +2187,13 @@ int vxt_step(vxt_emulator_t *e)
 			else if (!e->i_d) // RET|RETF imm16
 				e->regs16[REG_SP] += e->i_data0
 		OPCODE 20: // MOV r/m, immed
-			R_M_OP(e->mem[e->op_from_addr], =, e->i_data2)
+			R_M_OP(e->op_from_addr, =, e->i_data2);
+			CODE_WRITE(e->op_from_addr)
 		OPCODE 21: // IN AL/AX, DX/imm8
-			e->io_ports[0x20] = 0; // PIC EOI
-			e->io_ports[0x42] = --e->io_ports[0x40]; // PIT channel 0/2 read placeholder
-			e->io_ports[0x201] = 0; // Reset joystick
-			e->io_ports[0x3DA] ^= 9; // CGA refresh
-			e->scratch_uint = e->extra ? e->regs16[REG_DX] : (unsigned char)e->i_data0;
-			e->scratch_uint == 0x60 && (e->io_ports[0x64] = 0); // Scancode read flag
-			e->scratch_uint == 0x3D5 && (e->io_ports[0x3D4] >> 1 == 7) && (e->io_ports[0x3D5] = ((e->mem[0x49E]*80 + e->mem[0x49D] + CAST(short)e->mem[0x4AD]) & (e->io_ports[0x3D4] & 1 ? 0xFF : 0xFF00)) >> (e->io_ports[0x3D4] & 1 ? 0 : 8)); // CRT cursor position
-			e->scratch_uint == 0x201 && printf("Warning! Reading joystick data directly is not supported!\n");
-			e->port_map && e->port_map->filter(e->port_map->userdata, e->scratch_uint, 0) && (e->io_ports[e->scratch_uint] = e->port_map->in(e->port_map->userdata, e->scratch_uint));
-			R_M_OP(e->regs8[REG_AL], =, e->io_ports[e->scratch_uint]);
+			e->scratch_uint = port_in(e, e->extra ? e->regs16[REG_DX] : (unsigned char)e->i_data0, e->i_w);
+			e->i_w ? (e->regs16[REG_AX] = e->scratch_uint) : (e->regs8[REG_AL] = e->scratch_uint)
 		OPCODE 22: // OUT DX/imm8, AL/AX
-			e->scratch_uint = e->extra ? e->regs16[REG_DX] : (unsigned char)e->i_data0;
-			R_M_OP(e->io_ports[e->scratch_uint], =, e->regs8[REG_AL]);
-			e->scratch_uint == 0x61 && (e->io_hi_lo = 0, e->spkr_en |= e->regs8[REG_AL] & 3); // Speaker control
-			(e->scratch_uint == 0x40 || e->scratch_uint == 0x42) && (e->io_ports[0x43] & 6) && (e->mem[0x469 + e->scratch_uint - (e->io_hi_lo ^= 1)] = e->regs8[REG_AL]); // PIT rate programming
-			e->scratch_uint == 0x43 && e->pause_audio && (e->io_hi_lo = 0, e->regs8[REG_AL] >> 6 == 2) && (e->pause_audio((e->regs8[REG_AL] & 0xF7) != 0xB6), 0); // Speaker enable
-			e->scratch_uint == 0x3D5 && (e->io_ports[0x3D4] >> 1 == 6) && (e->mem[0x4AD + !(e->io_ports[0x3D4] & 1)] = e->regs8[REG_AL]); // CRT video RAM start offset
-			e->scratch_uint == 0x3D5 && (e->io_ports[0x3D4] >> 1 == 7) && (e->scratch2_uint = ((e->mem[0x49E]*80 + e->mem[0x49D] + CAST(short)e->mem[0x4AD]) & (e->io_ports[0x3D4] & 1 ? 0xFF00 : 0xFF)) + (e->regs8[REG_AL] << (e->io_ports[0x3D4] & 1 ? 0 : 8)) - CAST(short)e->mem[0x4AD], e->mem[0x49D] = e->scratch2_uint % 80, e->mem[0x49E] = e->scratch2_uint / 80); // CRT cursor position
-			e->scratch_uint == 0x3B5 && e->io_ports[0x3B4] == 1 && (e->GRAPHICS_X = e->regs8[REG_AL] * 16); // Hercules resolution reprogramming. Defaults are set in the BIOS
-			e->scratch_uint == 0x3B5 && e->io_ports[0x3B4] == 6 && (e->GRAPHICS_Y = e->regs8[REG_AL] * 4);
-			e->scratch_uint == 0x201 && printf("Warning! Writing joystick data directly is not supported!\n");
-			e->port_map && e->port_map->filter(e->port_map->userdata, e->scratch_uint, 1) && (e->port_map->out(e->port_map->userdata, e->scratch_uint, e->regs8[REG_AL]), 0);
+			port_out(e, e->extra ? e->regs16[REG_DX] : (unsigned char)e->i_data0, e->regs16[REG_AX], e->i_w)
 		OPCODE 23: // REPxx
 			e->rep_override_en = 2;
 			e->rep_mode = e->i_w;
@@ -675,9 +2207,11 @@ int vxt_step(vxt_emulator_t *e)
 			e->seg_override = e->extra;
 			e->rep_override_en && e->rep_override_en++
 		OPCODE 28: // DAA/DAS
+			sync_flags(e);
 			e->i_w = 0;
 			e->extra ? DAA_DAS(-=, >=, 0xFF, 0x99) : DAA_DAS(+=, <, 0xF0, 0x90) // extra = 0 for DAA, 1 for DAS
 		OPCODE 29: // AAA/AAS
+			sync_flags(e);
 			e->op_result = AAA_AAS(e, e->extra - 1)
 		OPCODE 30: // CBW
 			e->regs8[REG_AH] = -SIGN_OF(e->regs8[REG_AL])
@@ -702,17 +2236,24 @@ int vxt_step(vxt_emulator_t *e)
 		OPCODE 37: // LES|LDS reg, r/m
 			e->i_w = e->i_d = 1;
 			DECODE_RM_REG;
-			OP(=);
+			OP_W(=);
 			MEM_OP(REGS_BASE + e->extra, =, e->rm_addr + 2)
 		OPCODE 38: // INT 3
 			++e->reg_ip;
 			pc_interrupt(e, 3)
 		OPCODE 39: // INT imm8
+			if ((byte)e->i_data0 == 0x16 && keyboard_idle(e))
+				break;
 			e->reg_ip += 2;
 			pc_interrupt(e, e->i_data0)
+		OPCODE 53: // ESC (extra=3) runs on the 8087. HLT (extra=2) waits at the instruction while idle. LOCK and WAIT do nothing, the 8087 is never busy.
+			if (e->extra == 3)
+				fpu_exec(e);
+			else if (e->extra == 2 && go_idle(e))
+				e->reg_ip--;
 		OPCODE 40: // INTO
 			++e->reg_ip;
-			e->regs8[FLAG_OF] && pc_interrupt(e, 4)
+			get_flag(e, FLAG_OF) && pc_interrupt(e, 4)
 		OPCODE 41: // AAM
 			if (e->i_data0 &= 0xFF)
 				e->regs8[REG_AH] = e->regs8[REG_AL] / e->i_data0,
@@ -731,7 +2272,56 @@ int vxt_step(vxt_emulator_t *e)
 		OPCODE 46: // CLC|STC|CLI|STI|CLD|STD
 			e->regs8[e->extra / 2] = e->extra & 1
 		OPCODE 47: // TEST AL/AX, immed
-			R_M_OP(e->regs8[REG_AL], &, e->i_data0)
+			R_M_OP(REGS_BASE, &, e->i_data0)
+		OPCODE 49: // ENTER imm16, imm8 (80186)
+			R_M_PUSH(e->regs16[REG_BP]);
+			e->scratch_uint = e->regs16[REG_SP];
+			if ((e->scratch2_uint = e->i_data2 & 31))
+			{
+				while (--e->scratch2_uint)
+					e->regs16[REG_BP] -= 2,
+					R_M_PUSH(load16(e->mem + SEGREG(REG_SS, REG_BP,)));
+				R_M_PUSH(e->scratch_uint);
+			}
+			e->regs16[REG_BP] = e->scratch_uint;
+			e->regs16[REG_SP] -= e->i_data0
+		OPCODE 50: // LEAVE (80186)
+			e->regs16[REG_SP] = e->regs16[REG_BP];
+			R_M_POP(e->regs16[REG_BP])
+		OPCODE 51: // PUSHA (80186), SP as it was before the first push
+			e->scratch_uint = e->regs16[REG_SP];
+			for (e->scratch2_uint = REG_AX; e->scratch2_uint <= REG_DI; e->scratch2_uint++)
+				R_M_PUSH(e->scratch2_uint == REG_SP ? e->scratch_uint : e->regs16[e->scratch2_uint])
+		OPCODE 54: // POPA (80186), the saved SP is discarded
+			for (e->scratch2_uint = REG_DI + 1; e->scratch2_uint--;)
+				if (e->scratch2_uint == REG_SP)
+					e->regs16[REG_SP] += 2;
+				else
+					R_M_POP(e->regs16[e->scratch2_uint])
+		OPCODE 55: // PUSH imm16 (extra=0)|IMUL reg, r/m, imm16 (extra=1)|PUSH imm8 (extra=2)|IMUL reg, r/m, imm8 (extra=3) (80186)
+			if (e->extra & 1)
+				e->op_result = (short)read_operand(e, e->rm_addr) * (e->extra & 2 ? (char)e->i_data2 : (short)e->i_data2),
+				e->regs16[e->i_reg] = e->op_result,
+				set_OF(e, set_CF(e, e->op_result - (short)e->op_result));
+			else
+				R_M_PUSH(e->extra & 2 ? (char)e->i_data0 : e->i_data0)
+		OPCODE 56: // BOUND reg, r/m (80186). INT 5 returns to the BOUND instruction.
+			if ((short)e->regs16[e->i_reg] < (short)load16(e->mem + e->rm_addr) || (short)e->regs16[e->i_reg] > (short)load16(e->mem + e->rm_addr + 2))
+				pc_interrupt(e, 5)
+		OPCODE 57: // INSx (extra=0)|OUTSx (extra=1) (80186)
+			e->scratch2_uint = e->seg_override_en ? e->seg_override : REG_DS;
+			e->rep_override_en && (e->cycles = REP_CYCLES + e->cycles * e->regs16[REG_CX]);
+			for (e->scratch_uint = e->rep_override_en ? e->regs16[REG_CX] : 1; e->scratch_uint; e->scratch_uint--)
+				if (e->extra)
+					port_out(e, e->regs16[REG_DX], read_operand(e, SEGREG(e->scratch2_uint, REG_SI,)), e->i_w),
+					INDEX_INC(REG_SI);
+				else
+					R_M_OP(SEGREG(REG_ES, REG_DI,), =, port_in(e, e->regs16[REG_DX], e->i_w)),
+					CODE_WRITE(SEGREG(REG_ES, REG_DI,)),
+					INDEX_INC(REG_DI);
+
+			if (e->rep_override_en)
+				e->regs16[REG_CX] = 0
 		OPCODE 48: // Emulator-specific 0F xx opcodes
 			switch ((char)e->i_data0)
 			{
@@ -748,15 +2338,19 @@ int vxt_step(vxt_emulator_t *e)
 					);
 				OPCODE 2: // GET_RTC
 					memcpy(e->mem + SEGREG(REG_ES, REG_BX,), e->clock->localtime(e->clock->userdata), sizeof(struct tm));
-					CAST(short)e->mem[SEGREG(REG_ES, REG_BX, 36+)] = e->clock->millitm(e->clock->userdata);
+					store16(e->mem + SEGREG(REG_ES, REG_BX, 36+), e->clock->millitm(e->clock->userdata));
+					invalidate_code(e, SEGREG(REG_ES, REG_BX,), 38);
 				OPCODE 3: // DISK_READ
 				OPCODE_CHAIN 4: // DISK_WRITE
 					if (e->disk[e->regs8[REG_DL]])
 					{
 						e->scratch_disk = e->disk[e->regs8[REG_DL]];
-						e->regs8[REG_AL] = ~e->scratch_disk->seek(e->scratch_disk->userdata, CAST(unsigned)e->regs16[REG_BP] << 9, 0)
+						e->scratch_uint = ~e->scratch_disk->seek(e->scratch_disk->userdata, load32(e->regs8 + 2 * REG_BP) << 9, 0)
 							? ((char)e->i_data0 == 4 ? (int(*)())e->scratch_disk->write : (int(*)())e->scratch_disk->read)(e->scratch_disk->userdata, e->mem + SEGREG(REG_ES, REG_BX,), e->regs16[REG_AX])
 							: 0;
+						e->regs8[REG_AL] = e->scratch_uint;
+						// AX holds a byte count. Only the bytes a read actually stored can hold stale code or video data.
+						(char)e->i_data0 == 3 && e->scratch_uint && (watch_write(e, SEGREG(REG_ES, REG_BX,), e->scratch_uint), 0);
 					} else e->regs8[REG_AL] = 0;
 				OPCODE 5: // SERIAL_COM
 					{
@@ -774,92 +2368,591 @@ int vxt_step(vxt_emulator_t *e)
 
 	// Increment instruction pointer by computed instruction length. Tables in the BIOS binary
 	// help us here.
-	e->reg_ip += (e->i_mod*(e->i_mod != 3) + 2*(!e->i_mod && e->i_rm == 6))*e->i_mod_size + decode_lookup[TABLE_BASE_INST_SIZE][e->raw_opcode_id] + decode_lookup[TABLE_I_W_SIZE][e->raw_opcode_id]*(e->i_w + 1);
+	const opcode_desc_t *desc = &opcode_table[e->raw_opcode_id];
+	e->reg_ip += (e->i_mod*(e->i_mod != 3) + 2*(!e->i_mod && e->i_rm == 6))*e->i_mod_size + desc->base_size + desc->i_w_adder*(e->i_w + 1);
 
-	// If instruction needs to update SF, ZF and PF, set them as appropriate
-	if (e->set_flags_type & FLAGS_UPDATE_SZP)
-	{
-		e->regs8[FLAG_SF] = SIGN_OF(e->op_result);
-		e->regs8[FLAG_ZF] = !e->op_result;
-		e->regs8[FLAG_PF] = decode_lookup[TABLE_PARITY_FLAG][(unsigned char)e->op_result];
+	update_flags(e, e->set_flags_type);
+	return 1;
+}
+
+// Deliver trap and hardware interrupts between instructions
+static void check_interrupts(vxt_emulator_t *e)
+{
+	// Application has set trap flag, so fire INT 1
+	if (e->trap_flag)
+		pc_interrupt(e, 1);
+
+	e->trap_flag = e->regs8[FLAG_TF];
+
+	// If the PIC has a request pending, interrupts are enabled, and no overrides/REP are active, then acknowledge it.
+	// Lower priority requests are delivered by later checks, once the handler has sent EOI.
+	if (e->pic_pending && !e->seg_override_en && !e->rep_override_en && e->regs8[FLAG_IF] && !e->regs8[FLAG_TF])
+		pc_interrupt(e, pic_acknowledge(e)),
+		e->vclock += e->cycle_timing ? IRQ_CYCLES : 0;
+}
+
+// Decode and execute a single instruction. Returns zero if the guest requested shutdown.
+static int execute(vxt_emulator_t *e)
+{
+	fetch_instruction(e);
+	if (!exec_instruction(e))
+		return 0;
+
+	check_interrupts(e);
+	return 1;
+}
+
+// Returns non-zero if any of the len bytes at offset ofs into video RAM were written since the last refresh
+static int video_written(vxt_emulator_t *e, unsigned ofs, unsigned len)
+{
+	for (unsigned page = ofs >> CODE_PAGE_SHIFT; page <= (ofs + len - 1) >> CODE_PAGE_SHIFT && page < (VIDEO_RAM_SIZE >> CODE_PAGE_SHIFT); page++)
+		if (e->video_dirty[page])
+			return 1;
+	return 0;
+}
+
+// Expansion of a video RAM byte to eight RGB332 pixels. In CGA mode these are four pixels of two bits, each shown
+// twice, coloured by the background and palette selected on port 3D9h. In Hercules mode they are eight pixels of one bit.
+static void build_gfx_expand(vxt_emulator_t *e)
+{
+	byte select = e->io_ports[0x3D9], colors[4] = {cga_colors[select & 15]};
+	for (int n = 1; n < 4; n++)
+		colors[n] = cga_colors[2 * n + (select >> 5 & 1) + (select & 0x10 ? 8 : 0)];
 
-		// If instruction is an arithmetic or logic operation, also set AF/OF/CF as appropriate.
-		if (e->set_flags_type & FLAGS_UPDATE_AO_ARITH)
-			set_AF_OF_arith(e);
-		if (e->set_flags_type & FLAGS_UPDATE_OC_LOGIC)
-			set_CF(e, 0), set_OF(e, 0);
+	for (int v = 0; v < 256; v++)
+	{
+		byte pixels[8];
+		for (int i = 0; i < 8; i++)
+			pixels[i] = e->mem[0x4AC] ? colors[v >> (6 - i / 2 * 2) & 3] : (v >> (7 - i) & 1) * 0xFF;
+		memcpy(e->gfx_expand + v, pixels, sizeof(pixels));
 	}
+}
+
+// Offset from the start of the video page to scanline y. CGA shows each of its 200 lines twice and interlaces them
+// over two banks, Hercules interlaces over four.
+static unsigned scanline_offset(vxt_emulator_t *e, int y)
+{
+	return e->mem[0x4AC] ? 0x2000 * (y / 2 % 2) + y / 4 * (e->GRAPHICS_X / 8) : 0x2000 * (y % 4) + y / 4 * (e->GRAPHICS_X / 8);
+}
+
+// Convert len bytes of a scanline to pixels, pairing two expansions per 16-byte store where SSE2 is available
+static void expand_scanline(byte *dst, const byte *src, unsigned len, const unsigned long long *expand)
+{
+	unsigned i = 0;
+#ifdef __SSE2__
+	for (; i + 2 <= len; i += 2)
+		_mm_storeu_si128((__m128i*)(dst + 8 * i), _mm_set_epi64x((long long)expand[src[i + 1]], (long long)expand[src[i]]));
+#endif
+	for (; i < len; i++)
+		store64(dst + 8 * i, expand[src[i]]);
+}
 
-	// Poll timer/keyboard every 100 times a second
-	clock_t t = clock();
-	if (t - e->kb_timer >= CLOCKS_PER_SEC / 100) {
-		e->int8_asap = 1;
-		e->kb_timer = t;
+// Refresh video display from emulated graphics card video RAM. Only scanlines and text rows whose video RAM was written
+// since the last refresh are redrawn.
+static void refresh_video(vxt_emulator_t *e)
+{
+	int blink = e->blink = (e->frame_count++ / 20) % 2;
+
+	byte vm = e->io_ports[0x3B8];
+	if (e->video_mode != vm)
+	{
+		e->video_mode = vm;
+
+		// Video card in graphics mode?
+		if (vm & 2)
+		{
+			e->gfx_palette = ~0u;
+			e->video->initialize(e->video->userdata, e->mem[0x4AC] ? VXT_CGA : VXT_HERCULES, e->GRAPHICS_X, e->GRAPHICS_Y);
+		}
+		else
+		{
+			e->video->initialize(e->video->userdata, VXT_TEXT, 640, 200);
+		}
+		e->video_full = 1;
 	}
 
-	// Update the video graphics display at 60Hz
-	if (!e->screen_off && t - e->video_timer >= CLOCKS_PER_SEC / 60)
+	if (vm & 2)
 	{
-		e->video_timer = t;
-		e->blink = (t / (CLOCKS_PER_SEC / 3)) % 2;
+		// A new palette recolours the whole screen
+		unsigned palette = e->mem[0x4AC] ? 0x100 | e->io_ports[0x3D9] : 0;
+		palette != e->gfx_palette && (e->gfx_palette = palette, build_gfx_expand(e), e->video_full = 1);
 
-		byte vm = e->io_ports[0x3B8];
-		if (e->video_mode != vm)
+		byte *base = e->mem + VIDEO_RAM_BASE + 0x8000*(e->mem[0x4AC] ? 1 : e->io_ports[0x3B8] >> 7); // B800:0 for CGA/Hercules bank 2, B000:0 for Hercules bank 1
+		base != e->vid_mem_base && (e->vid_mem_base = base, e->video_full = 1);
+
+		// Each scanline reads GRAPHICS_X / 8 consecutive bytes of video RAM. The frontend presents the backbuffer on the
+		// next call, so a clean frame still asks for it once after a frame that drew.
+		byte *pixels = 0;
+		for (int y = 0, len = e->GRAPHICS_X / 8; y < e->GRAPHICS_Y; y++)
 		{
-			e->video_mode = vm;
+			unsigned ofs = (unsigned)(base - e->mem - VIDEO_RAM_BASE) + scanline_offset(e, y);
+			if (!e->video_full && !video_written(e, ofs, len))
+				continue;
 
-			// Video card in graphics mode?
-			if (vm & 2)
-			{
-				// Create memory map.
-				for (int i = 0; i < e->GRAPHICS_X * e->GRAPHICS_Y / 4; i++)
-					e->vid_addr_lookup[i] = i / e->GRAPHICS_X * (e->GRAPHICS_X / 8) + (i / 2) % (e->GRAPHICS_X / 8) + 0x2000*(e->mem[0x4AC] ? (2 * i / e->GRAPHICS_X) % 2 : (4 * i / e->GRAPHICS_X) % 4);
-				
-				e->video->initialize(e->video->userdata, e->mem[0x4AC] ? VXT_CGA : VXT_HERCULES, e->GRAPHICS_X, e->GRAPHICS_Y);
-			}
-			else
-			{
-				e->video->initialize(e->video->userdata, VXT_TEXT, 640, 200);
-			}
+			pixels || (pixels = e->video->backbuffer(e->video->userdata));
+			expand_scanline(pixels + y * e->GRAPHICS_X, e->mem + VIDEO_RAM_BASE + ofs, len, e->gfx_expand);
 		}
+		pixels || !e->video_drawn || e->video->backbuffer(e->video->userdata);
+		e->video_drawn = pixels != 0;
+	}
+	else
+	{
+		// Rows the cursor leaves and enters, and rows with blinking characters when the blink phase changes
+		byte *text = e->mem + 0xB8000, cursor[3] = {e->mem[0x4A1], e->mem[0x49D], e->mem[0x49E]};
+		unsigned rows = 0;
+		for (int r = 0; r < 25; r++)
+			(e->video_full || video_written(e, 0x8000 + 160 * r, 160)) && (rows |= 1 << r);
+
+		if (memcmp(cursor, e->text_cursor, 3) || (cursor[0] && blink != e->text_blink))
+			rows |= (e->text_cursor[2] < 25 ? 1 << e->text_cursor[2] : 0) | (cursor[2] < 25 ? 1 << cursor[2] : 0);
+		if (blink != e->text_blink)
+			for (int i = 1; i < 80 * 25 * 2; i += 2)
+				text[i] & 0x80 && (rows |= 1 << i / 160);
+
+		rows && (e->video->textmode(text, e->font, cursor[0], cursor[1], cursor[2], rows), 0);
+		memcpy(e->text_cursor, cursor, 3);
+		e->text_blink = blink;
+	}
 
-		if (vm & 2)
+	memset(e->video_dirty, 0, sizeof(e->video_dirty));
+	e->video_full = 0;
+}
+
+// Run all events that are due at the current virtual time and reschedule them. If the guest went idle, virtual time
+// first skips ahead to the next event, and zero is returned so the run stops.
+static int run_events(vxt_emulator_t *e)
+{
+	int idle = e->idle;
+	if (idle)
+	{
+		e->idle = 0;
+		e->next_event = e->events[0].deadline;
+		if (e->next_event > e->vclock)
+			skip_time(e, e->next_event - e->vclock);
+	}
+
+	while (e->next_event <= e->vclock)
+	{
+		event_t ev = pop_event(e);
+		switch (ev.id)
 		{
-			if (e->mem[0x4AC]) for (int i = 0; i < 16; i++)
-				e->pixel_colors[i] = cga_colors[(i & 12) >> 2] + (cga_colors[i & 3] << 16); // CGA -> RGB332	
-			else for (int i = 0; i < 16; i++)
-				e->pixel_colors[i] = 0xFF*(((i & 1) << 24) + ((i & 2) << 15) + ((i & 4) << 6) + ((i & 8) >> 3)); // Hercules -> RGB332
-
-			// Refresh video display from emulated graphics card video RAM.
-			unsigned *pixels = (unsigned*)e->video->backbuffer(e->video->userdata);
-			e->vid_mem_base = e->mem + 0xB0000 + 0x8000*(e->mem[0x4AC] ? 1 : e->io_ports[0x3B8] >> 7); // B800:0 for CGA/Hercules bank 2, B000:0 for Hercules bank 1
-			for (int i = 0; i < e->GRAPHICS_X * e->GRAPHICS_Y / 4; i++)
-				pixels[i] = e->pixel_colors[15 & (e->vid_mem_base[e->vid_addr_lookup[i]] >> 4*!(i & 1))];
+			case EVENT_TIMER: // Rising edge of PIT counter 0, unless the clock rate changed since it was scheduled
+				pit_sync(e);
+				e->pit_clock >= e->pit_irq && (pic_raise(e, 0), 0);
+				pit_schedule(e);
+				break;
+			case EVENT_KEYBOARD: // Poll keyboard every 100 times a second, unless the last scancode is still unread
+				if (!(e->io_ports[0x64] & 1))
+				{
+					vxt_key_t key = e->video->getkey(e->video->userdata);
+					key.scancode && (e->io_ports[0x60] = e->mem[0x4A6] = key.scancode, e->mem[0x4A6+1] = key.ascii, e->io_ports[0x64] = 1, pic_raise(e, 1), 0);
+				}
+				schedule_event(e, EVENT_KEYBOARD, ev.deadline + event_period(e, 100));
+				break;
+			case EVENT_VIDEO: // Update the video graphics display at 60Hz
+				if (!e->screen_off)
+					refresh_video(e);
+				schedule_event(e, EVENT_VIDEO, ev.deadline + event_period(e, 60));
+				break;
 		}
-		else
+	}
+	return !idle;
+}
+
+// Calibrate the virtual clock frequency against the wall clock. Only called at batch boundaries.
+static void sync_vclock(vxt_emulator_t *e)
+{
+	unsigned long long now = host_time_us(), elapsed = now - e->sync_time;
+	if (elapsed < SYNC_INTERVAL_US)
+		return;
+
+	if (elapsed < SYNC_MAX_US)
+	{
+		unsigned long long freq = (e->vclock - e->sync_vclock) * 1000000 / elapsed;
+		freq = (e->vclock_freq + freq) / 2;
+		e->vclock_freq = freq < MIN_VCLOCK_FREQ ? MIN_VCLOCK_FREQ : (unsigned)freq;
+	}
+
+	e->sync_time = now;
+	e->sync_vclock = e->vclock;
+}
+
+// Fast-forward a busy-wait loop at CS:IP, LOOP $ or DEC reg16 / JNZ $-3. Iterations that jump back are skipped by
+// adjusting the counter register and virtual time, leaving the final one to run normally. Nothing is skipped past the
+// next event or max_instructions, or while an interrupt, trap or prefix could act in between, so the guest can not
+// tell the difference. Returns the number of instructions skipped.
+static size_t skip_spin(vxt_emulator_t *e, size_t max_instructions)
+{
+	if (e->seg_override_en || e->rep_override_en || e->trap_flag || e->regs8[FLAG_TF] || (e->regs8[FLAG_IF] && e->pic_pending) || e->vclock >= e->next_event)
+		return 0;
+
+	byte *ins = e->mem + 16 * e->regs16[REG_CS] + e->reg_ip;
+	unsigned len;
+	word *counter;
+	if (ins[0] == 0xE2 && ins[1] == 0xFE) // LOOP $
+		len = 1, counter = &e->regs16[REG_CX];
+	else if ((ins[0] & 0xF8) == 0x48 && ins[1] == 0x75 && ins[2] == 0xFD) // DEC reg16, JNZ $-3
+		len = 2, counter = &e->regs16[ins[0] & 7];
+	else
+		return 0;
+
+	// DEC sets all the flags it touches from its own operands, so they are right again after the iteration that runs.
+	// An iteration takes len virtual clock ticks, or the cycles of its instructions with the jump back taken.
+	unsigned ticks = e->cycle_timing ? cycle_table[ins[0]].reg + (len == 2 ? cycle_table[0x75].reg : 0) + JUMP_CYCLES : len;
+	unsigned long long k = (word)(*counter - 1);
+	if (max_instructions < len)
+		return 0;
+	if (k > (e->next_event - e->vclock - 1) / ticks)
+		k = (e->next_event - e->vclock - 1) / ticks;
+	if (k > (max_instructions - len) / len)
+		k = (max_instructions - len) / len;
+
+	*counter -= (word)k;
+	e->vclock += k * ticks;
+	return k * len;
+}
+
+// Only LOOP and DEC reg16 can start a loop skip_spin recognises
+#define SPIN_CANDIDATE(op) ((op) == 0xE2 || ((op) & 0xF8) == 0x48)
+
+#ifndef VXT_THREADED
+
+// Execute the second instruction of a pair started by the instruction that just ran, straight from guest memory, and
+// set its cycles. Returns zero if CS:IP does not hold the expected instruction. Only called when nothing is pending in
+// between.
+static int exec_fused(vxt_emulator_t *e, byte fuse)
+{
+	byte *next = e->mem + 16 * e->regs16[REG_CS] + e->reg_ip;
+	if (fuse == FUSE_JCC && (*next & 0xF0) == 0x70)
+	{
+		byte c = *next / 2 & 7, taken = (*next & 1) ^ (get_flag(e, jxx_dec_a[c]) || get_flag(e, jxx_dec_b[c]) || get_flag(e, jxx_dec_c[c]) ^ get_flag(e, jxx_dec_d[c]));
+		e->reg_ip += 2 + (char)next[1] * taken;
+		e->cycles = cycle_table[*next].reg + JUMP_CYCLES * taken;
+		return 1;
+	}
+	if (fuse == FUSE_STOS && *next == e->raw_opcode_id - 2) // STOSx of the same width, i_w is still set from LODSx
+	{
+		MEM_OP_W(SEGREG(REG_ES, REG_DI,), =, REGS_BASE);
+		INDEX_INC(REG_DI);
+		e->reg_ip++;
+		e->cycles = cycle_table[*next].reg;
+		return 1;
+	}
+	return 0;
+}
+
+// Execute instructions one at a time through the opcode switch. The second instruction of a fusable pair runs
+// directly after the first, unless an interrupt, trap, prefix or event falls between them.
+static size_t run_interpreter(vxt_emulator_t *e, size_t max_instructions, int *running)
+{
+	for (size_t n = 0; n < max_instructions; n++)
+	{
+		byte fuse = fetch_instruction(e)->fuse;
+		if (SPIN_CANDIDATE(e->raw_opcode_id))
+			n += skip_spin(e, max_instructions - n);
+		if (!exec_instruction(e))
+			return *running = 0, n;
+		check_interrupts(e);
+
+		if ((e->vclock += INSTRUCTION_TICKS) >= e->next_event)
 		{
-			e->video->textmode(&e->mem[0xB8000], e->font, e->mem[0x4A1], e->mem[0x49D], e->mem[0x49E]);
+			if (!run_events(e))
+				return n + 1;
+		}
+		else if (fuse && n + 1 < max_instructions && !e->seg_override_en && !e->rep_override_en && !e->trap_flag
+				 && !e->regs8[FLAG_TF] && !(e->regs8[FLAG_IF] && e->pic_pending) && exec_fused(e, fuse))
+		{
+			n++;
+			if ((e->vclock += INSTRUCTION_TICKS) >= e->next_event && !run_events(e))
+				return n + 1;
 		}
 	}
+	return max_instructions;
+}
 
-	// Application has set trap flag, so fire INT 1
-	if (e->trap_flag)
-		pc_interrupt(e, 1);
+#else
 
-	e->trap_flag = e->regs8[FLAG_TF];
+// Threaded interpreter. Common opcodes have their own handler, specialised at compile time for opcode, operand width and
+// direction, and every handler dispatches the next instruction itself through a computed goto. Anything else, and any
+// instruction under a segment override or REP prefix, runs through exec_instruction.
+
+#define THREADED_INLINE static inline __attribute__((always_inline))
+
+// Increment IP and record flags like exec_instruction does, for an opcode known at compile time
+THREADED_INLINE void threaded_finish(vxt_emulator_t *e, const byte op, const int w)
+{
+	e->reg_ip += (e->i_mod*(e->i_mod != 3) + 2*(!e->i_mod && e->i_rm == 6))*opcode_table[op].i_mod_adder + opcode_table[op].base_size + opcode_table[op].i_w_adder*(w + 1);
+	update_flags(e, opcode_table[op].set_flags_type);
+}
+
+// ADD|OR|ADC|SBB|AND|SUB|XOR|CMP|MOV reg, r/m
+THREADED_INLINE void threaded_alu(vxt_emulator_t *e, const byte op, const int w, const int d, const int x)
+{
+	DECODE_RM_REG_N(w, d);
+	switch (x)
+	{
+		OPCODE_CHAIN 0: // ADD
+			MEM_OP_W_N(w, e->op_to_addr, +=, e->op_from_addr),
+			set_CF(e, (unsigned)e->op_result < e->op_dest)
+		OPCODE 1: // OR
+			MEM_OP_W_N(w, e->op_to_addr, |=, e->op_from_addr)
+		OPCODE 2: // ADC
+			ADC_SBB_MACRO(+)
+		OPCODE 3: // SBB
+			ADC_SBB_MACRO(-)
+		OPCODE 4: // AND
+			MEM_OP_W_N(w, e->op_to_addr, &=, e->op_from_addr)
+		OPCODE 5: // SUB
+			MEM_OP_W_N(w, e->op_to_addr, -=, e->op_from_addr),
+			set_CF(e, (unsigned)e->op_result > e->op_dest)
+		OPCODE 6: // XOR
+			MEM_OP_W_N(w, e->op_to_addr, ^=, e->op_from_addr)
+		OPCODE 7: // CMP
+			MEM_OP_N(w, e->op_to_addr, -, e->op_from_addr),
+			set_CF(e, (unsigned)e->op_result > e->op_dest)
+		OPCODE 8: // MOV
+			MEM_OP_W_N(w, e->op_to_addr, =, e->op_from_addr);
+	}
+	threaded_finish(e, op, w);
+}
 
-	// If a timer tick is pending, interrupts are enabled, and no overrides/REP are active,
-	// then process the tick and check for new keystrokes
-	if (e->int8_asap && !e->seg_override_en && !e->rep_override_en && e->regs8[FLAG_IF] && !e->regs8[FLAG_TF])
+// MOV reg, imm
+THREADED_INLINE void threaded_mov_imm(vxt_emulator_t *e, const byte op, const int w)
+{
+	e->i_w = w;
+	R_M_OP_N(w, GET_REG_ADDR_N(w, (op & 7)), =, e->i_data0);
+	threaded_finish(e, op, w);
+}
+
+// Conditional jump (JAE, JNAE, etc.)
+THREADED_INLINE void threaded_jcc(vxt_emulator_t *e, const byte op)
+{
+	const byte c = e->scratch_uchar = op / 2 & 7, taken = (op & 1) ^ (get_flag(e, jxx_dec_a[c]) || get_flag(e, jxx_dec_b[c]) || get_flag(e, jxx_dec_c[c]) ^ get_flag(e, jxx_dec_d[c]));
+	e->reg_ip += (char)e->i_data0 * taken;
+	e->cycles += JUMP_CYCLES * taken;
+	threaded_finish(e, op, op & 1);
+}
+
+// PUSH|POP regs16
+THREADED_INLINE void threaded_stack(vxt_emulator_t *e, const byte op)
+{
+	if (op < 0x58)
+		R_M_PUSH(e->regs16[op & 7]);
+	else
+		R_M_POP(e->regs16[op & 7]);
+	threaded_finish(e, op, 1);
+}
+
+#define THREADED_ALU_OPCODES(X) X(0x00) X(0x01) X(0x02) X(0x03) X(0x08) X(0x09) X(0x0A) X(0x0B) X(0x10) X(0x11) X(0x12) X(0x13) \
+								X(0x18) X(0x19) X(0x1A) X(0x1B) X(0x20) X(0x21) X(0x22) X(0x23) X(0x28) X(0x29) X(0x2A) X(0x2B) \
+								X(0x30) X(0x31) X(0x32) X(0x33) X(0x38) X(0x39) X(0x3A) X(0x3B) X(0x88) X(0x89) X(0x8A) X(0x8B)
+#define THREADED_MOV_IMM_OPCODES(X) X(0xB0) X(0xB1) X(0xB2) X(0xB3) X(0xB4) X(0xB5) X(0xB6) X(0xB7) \
+									X(0xB8) X(0xB9) X(0xBA) X(0xBB) X(0xBC) X(0xBD) X(0xBE) X(0xBF)
+#define THREADED_JCC_OPCODES(X) X(0x70) X(0x71) X(0x72) X(0x73) X(0x74) X(0x75) X(0x76) X(0x77) \
+								X(0x78) X(0x79) X(0x7A) X(0x7B) X(0x7C) X(0x7D) X(0x7E) X(0x7F)
+#define THREADED_STACK_OPCODES(X) X(0x50) X(0x51) X(0x52) X(0x53) X(0x54) X(0x55) X(0x56) X(0x57) \
+								  X(0x58) X(0x59) X(0x5A) X(0x5B) X(0x5C) X(0x5D) X(0x5E) X(0x5F)
+
+// Finish the current instruction like vxt_run does, then fetch and dispatch the next one
+#define THREADED_NEXT \
+	check_interrupts(e); \
+	if (++n, (e->vclock += INSTRUCTION_TICKS) >= e->next_event && !run_events(e)) \
+		return n; \
+	THREADED_DISPATCH
+#define THREADED_DISPATCH \
+	if (n == max_instructions) \
+		return n; \
+	fetch_instruction(e); \
+	goto *(e->seg_override_en || e->rep_override_en ? &&generic : handlers[e->raw_opcode_id])
+
+#define THREADED_ENTRY(op) handlers[op] = &&op_##op;
+#define THREADED_ALU(op) op_##op: threaded_alu(e, op, op & 1, op >> 1 & 1, op < 0x40 ? op >> 3 : 8); THREADED_NEXT;
+#define THREADED_MOV_IMM(op) op_##op: threaded_mov_imm(e, op, !!(op & 8)); THREADED_NEXT;
+#define THREADED_JCC(op) op_##op: threaded_jcc(e, op); THREADED_NEXT;
+#define THREADED_STACK(op) op_##op: threaded_stack(e, op); THREADED_NEXT;
+
+static size_t run_interpreter(vxt_emulator_t *e, size_t max_instructions, int *running)
+{
+	// Label addresses are only known inside the function, so the table is filled on the first call. Opcode 0 always
+	// has its own handler.
+	static const void *handlers[0x100];
+	if (!handlers[0])
+	{
+		for (int i = 0; i < 0x100; i++)
+			handlers[i] = &&generic;
+		THREADED_ALU_OPCODES(THREADED_ENTRY)
+		THREADED_MOV_IMM_OPCODES(THREADED_ENTRY)
+		THREADED_JCC_OPCODES(THREADED_ENTRY)
+		THREADED_STACK_OPCODES(THREADED_ENTRY)
+	}
+	size_t n = 0;
+
+	THREADED_DISPATCH;
+
+	generic:
+		if (SPIN_CANDIDATE(e->raw_opcode_id))
+			n += skip_spin(e, max_instructions - n);
+		if (!exec_instruction(e))
+			return *running = 0, n;
+		THREADED_NEXT;
+
+	THREADED_ALU_OPCODES(THREADED_ALU)
+	THREADED_MOV_IMM_OPCODES(THREADED_MOV_IMM)
+	THREADED_JCC_OPCODES(THREADED_JCC)
+	THREADED_STACK_OPCODES(THREADED_STACK)
+}
+
+#endif
+
+// Returns non-zero if the currently decoded instruction has to be the last one of a block. That is any instruction
+// that may transfer control, change the interrupt or trap state, talk to a device or call into the emulator.
+static int ends_block(vxt_emulator_t *e)
+{
+	byte op = e->raw_opcode_id;
+	return (op >= 0x70 && op <= 0x7F) // Jcc
+		|| (op >= 0xE0 && op <= 0xEF) // LOOPxx, JCXZ, IN, OUT, CALL, JMP
+		|| (op >= 0xCA && op <= 0xCF) || op == 0xC2 || op == 0xC3 || op == 0x9A // RETF, INT, INTO, IRET, RET, CALL far
+		|| op == 0x0F || op == 0x9D || op == 0xD4 || op == 0xF4 || op == 0xFA || op == 0xFB // EMUCTL, POPF, AAM, HLT, CLI, STI
+		|| op == 0x62 || (op >= 0x6C && op <= 0x6F) // BOUND, INS, OUTS
+		|| ((op == 0xF6 || op == 0xF7) && e->i_reg >= 6) // DIV, IDIV
+		|| ((op == 0xFE || op == 0xFF) && e->i_reg >= 2 && e->i_reg <= 5) // CALL, JMP
+		|| (op == 0x8E && e->i_reg == 1); // MOV CS
+}
+
+// Non-zero if an event is due or an interrupt can be delivered after the instruction that just ran. The block stops
+// there, so check_interrupts and run_events act after the same instruction as in the interpreter.
+#define BLOCK_INTERRUPTED (e->vclock >= e->next_event || (e->pic_pending && e->regs8[FLAG_IF] && !e->seg_override_en && !e->rep_override_en))
+
+static int block_valid(vxt_emulator_t *e, const block_t *b, unsigned addr)
+{
+	return b->addr == addr && b->gen[0] == e->code_gen[addr >> CODE_PAGE_SHIFT] && b->gen[1] == e->code_gen[b->last_page];
+}
+
+// Execute a cached block. Returns the number of instructions executed, and clears *running if the guest requested shutdown.
+static int run_block(vxt_emulator_t *e, const block_t *b, int *running)
+{
+	e->code_dirty = 0;
+	for (int n = 0; n < b->len;)
+	{
+		load_instruction(e, &b->code[n]);
+		if (!exec_instruction(e))
+			return *running = 0, n;
+		e->vclock += INSTRUCTION_TICKS;
+		n++;
+
+		// Stop early if the instruction stored into the block itself
+		if (e->code_dirty && (e->code_dirty = 0, !block_valid(e, b, b->addr)))
+			return n;
+		if (BLOCK_INTERRUPTED)
+			return n;
+	}
+	return b->len;
+}
+
+// Interpret instructions from addr while recording them into a block. Returns the number of instructions executed,
+// and clears *running if the guest requested shutdown. A recording cut short by a due event or interrupt is not kept.
+static int record_block(vxt_emulator_t *e, block_t *b, unsigned addr, int *running)
+{
+	unsigned page = addr >> CODE_PAGE_SHIFT, gen[2] = {e->code_gen[page], e->code_gen[page + 1]};
+	int n = 0, last = 0;
+
+	b->addr = NO_DECODE;
+	while (n < BLOCK_MAX_INSTRUCTIONS && !last)
+	{
+		// Blocks may not wrap around a segment or cover more than two pages
+		unsigned i_addr = 16 * e->regs16[REG_CS] + e->reg_ip;
+		if (i_addr < addr || (i_addr + DECODE_SPAN - 1) >> CODE_PAGE_SHIFT > page + 1)
+			break;
+
+		b->code[n] = *fetch_instruction(e);
+		last = ends_block(e);
+		if (!exec_instruction(e))
+			return *running = 0, n;
+		e->vclock += INSTRUCTION_TICKS;
+		n++;
+		if (!last && BLOCK_INTERRUPTED)
+			return n;
+	}
+
+	// Only keep the block if none of its code was written while it was recorded
+	if (gen[0] == e->code_gen[page] && gen[1] == e->code_gen[page + 1])
+	{
+		b->addr = addr;
+		b->len = n;
+		b->last_page = (b->code[n - 1].addr + DECODE_SPAN - 1) >> CODE_PAGE_SHIFT;
+		b->gen[0] = gen[0];
+		b->gen[1] = e->code_gen[b->last_page];
+	}
+	return n;
+}
+
+// Execute whole blocks while the budget allows. Timer, keyboard and video events are handled between blocks.
+static size_t run_blocks(vxt_emulator_t *e, size_t max_instructions, int *running)
+{
+	size_t n = 0;
+	while (*running && n < max_instructions)
 	{
-		pc_interrupt(e, 0xA), e->int8_asap = 0;
-		vxt_key_t key = e->video->getkey(e->video->userdata);
-		if (key.scancode) {
-			e->mem[0x4A6] = key.scancode;
-			e->mem[0x4A6+1] = key.ascii;
-			pc_interrupt(e, 0x1d);
+		int len;
+
+		// The trap flag needs an interrupt check after every instruction, so single-step while it is set
+		if (e->trap_flag || e->regs8[FLAG_TF] || max_instructions - n < BLOCK_MAX_INSTRUCTIONS)
+		{
+			if (!execute(e))
+				return *running = 0, n;
+			e->vclock += INSTRUCTION_TICKS;
+			len = 1;
+		}
+		else
+		{
+			n += skip_spin(e, max_instructions - n - BLOCK_MAX_INSTRUCTIONS);
+
+			unsigned addr = 16 * e->regs16[REG_CS] + e->reg_ip;
+			block_t *b = &e->block_cache[addr & (BLOCK_CACHE_SIZE - 1)];
+
+			len = block_valid(e, b, addr) ? run_block(e, b, running) : record_block(e, b, addr, running);
+			if (*running)
+				check_interrupts(e);
 		}
+
+		n += len;
+		if (e->vclock >= e->next_event && !run_events(e))
+			break;
 	}
+	return n;
+}
 
-	return 1;
+size_t vxt_run(vxt_emulator_t *e, size_t max_instructions, vxt_stop_t *reason)
+{
+	size_t n = 0;
+	vxt_stop_t r = VXT_STOP_BUDGET;
+
+	// We have no boot media!
+	if (!e->disk[0] && !e->disk[1])
+		r = VXT_STOP_NO_MEDIA;
+	else
+	{
+		int running = 1;
+		e->idle_skip = 0;
+		e->run_vclock = e->vclock;
+		n = e->core == VXT_CORE_BLOCK ? run_blocks(e, max_instructions, &running) : run_interpreter(e, max_instructions, &running);
+		if (!running) r = VXT_STOP_QUIT;
+		else if (e->idle_skip) r = VXT_STOP_IDLE;
+	}
+
+	// Leave the flags in the register file for anyone inspecting the emulator between runs
+	sync_flags(e);
+
+	// Only look at the wall clock when enough virtual time has passed
+	if (!e->fixed_freq && e->vclock - e->sync_vclock >= e->vclock_freq / 100)
+		sync_vclock(e);
+
+	if (reason) *reason = r;
+	return n;
+}
+
+int vxt_step(vxt_emulator_t *e)
+{
+	vxt_stop_t reason;
+	vxt_run(e, 1, &reason);
+	return reason == VXT_STOP_BUDGET || reason == VXT_STOP_IDLE;
 }
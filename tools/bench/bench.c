@@ -0,0 +1,147 @@
+// VirtualXT - Portable IBM PC/XT emulator written in C.
+// Copyright (c) 2019-2020 Andreas T Jonsson (mail@andreasjonsson.se)
+//
+// This work is licensed under the MIT License. See included LICENSE file.
+
+// Headless benchmark. The virtual clock and the guest RTC are both derived from the instruction count, so a run is
+// repeatable. The checksum covers the text screen as it is when the run ends. Builds and CPU cores deliver interrupts
+// after the same instructions, so their results are comparable as long as the checksums match.
+
+#include <vxt.h>
+#include "kb.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FREQUENCY 4770000
+#define BATCH 10000
+#define KEY_DELAY 25000000 // Start typing after this many instructions
+
+static byte *image;
+static size_t image_size, image_pos;
+static unsigned long long executed;
+static byte *screen;
+static const char *keys = "";
+static int key_polls, key_up;
+
+static size_t disk_read(void *ud, void *buf, size_t count)
+{
+	count = image_pos < image_size ? (count < image_size - image_pos ? count : image_size - image_pos) : 0;
+	memcpy(buf, image + image_pos, count);
+	image_pos += count;
+	return count;
+}
+
+static size_t disk_write(void *ud, const void *buf, size_t count)
+{
+	count = image_pos < image_size ? (count < image_size - image_pos ? count : image_size - image_pos) : 0;
+	memcpy(image + image_pos, buf, count);
+	image_pos += count;
+	return count;
+}
+
+static size_t disk_seek(void *ud, size_t offset, int whence)
+{
+	switch (whence)
+	{
+		case SEEK_SET: image_pos = offset; break;
+		case SEEK_CUR: image_pos += offset; break;
+		case SEEK_END: image_pos = image_size + offset; break;
+	}
+	return image_pos;
+}
+
+static struct tm *get_localtime(void *ud)
+{
+	static struct tm t;
+	unsigned long long s = executed / FREQUENCY;
+	memset(&t, 0, sizeof(t));
+	t.tm_year = 120; t.tm_mday = 1;
+	t.tm_hour = (int)(s / 3600 % 24); t.tm_min = (int)(s / 60 % 60); t.tm_sec = (int)(s % 60);
+	return &t;
+}
+
+static unsigned short get_millitm(void *ud) { return (unsigned short)(executed * 1000 / FREQUENCY % 1000); }
+
+// Type the key string, one press or release every third poll. '|' is Enter.
+static vxt_key_t getkey(void *ud)
+{
+	vxt_key_t key = {.scancode = VXT_KEY_INVALID, .ascii = 0};
+	if (executed < KEY_DELAY || !*keys || ++key_polls % 3)
+		return key;
+
+	key.ascii = *keys == '|' ? '\r' : *keys;
+	key.scancode = *keys == '|' ? VXT_KEY_ENTER : ascii2scan[*keys - 0x20];
+	if (key_up)
+		key.scancode |= VXT_MASK_KEY_UP, keys++;
+	key_up ^= 1;
+	return key;
+}
+
+static void initialize(void *ud, vxt_mode_t m, int x, int y) {}
+static byte *backbuffer(void *ud) { static byte buffer[720 * 350]; return buffer; }
+
+// How often this is called depends on which rows changed, so only remember where the screen is
+static void textmode(byte *mem, byte *font, byte cursor_start, byte cursor_x, byte cursor_y, unsigned rows) { screen = mem; }
+
+#define PARAM(p) (!strcmp(*argv, (p)))
+
+int main(int argc, char *argv[])
+{
+	unsigned long long instructions = 200000000;
+	const char *image_arg = 0, *core_arg = "interpreter";
+
+	while (--argc && ++argv) {
+		if (PARAM("-n")) { instructions = argc-- ? strtoull(*(++argv), 0, 10) * 1000000 : instructions; continue; }
+		if (PARAM("-k")) { keys = argc-- ? *(++argv) : keys; continue; }
+		if (PARAM("--core")) { core_arg = argc-- ? *(++argv) : core_arg; continue; }
+		if (**argv != '-') { image_arg = *argv; continue; }
+		printf("Invalid parameter: %s\n", *argv); return -1;
+	}
+
+	if (!image_arg)
+	{
+		printf("Usage: vxt-bench [-n million instructions] [-k keys] [--core interpreter|block] image\n");
+		return -1;
+	}
+
+	FILE *fp = fopen(image_arg, "rb");
+	if (!fp) { printf("Can't open image: %s\n", image_arg); return -1; }
+	fseek(fp, 0, SEEK_END);
+	image = (byte*)malloc(image_size = (size_t)ftell(fp));
+	fseek(fp, 0, SEEK_SET);
+	image_size = fread(image, 1, image_size, fp);
+	fclose(fp);
+
+	vxt_clock_t guest_clock = {.userdata = 0, .localtime = get_localtime, .millitm = get_millitm};
+	vxt_video_t video = {.userdata = 0, .getkey = getkey, .initialize = initialize, .backbuffer = backbuffer, .textmode = textmode};
+	vxt_emulator_t *e = vxt_open(&video, &guest_clock, VXT_INTERNAL_MEMORY);
+
+	vxt_drive_t fd = {.userdata = 0, .boot = 1, .read = disk_read, .write = disk_write, .seek = disk_seek};
+	vxt_replace_floppy(e, &fd);
+	vxt_set_frequency(e, FREQUENCY);
+
+	if (!strcmp(core_arg, "block")) vxt_set_core(e, VXT_CORE_BLOCK);
+	else if (strcmp(core_arg, "interpreter")) { printf("Invalid CPU core: %s\n", core_arg); return -1; }
+
+	clock_t start = clock();
+	while (executed < instructions)
+	{
+		vxt_stop_t reason;
+		executed += vxt_run(e, BATCH, &reason);
+		if (reason != VXT_STOP_BUDGET)
+			break;
+	}
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	unsigned checksum = 2166136261u;
+	for (int i = 0; screen && i < 80 * 25 * 2; i++)
+		checksum = (checksum ^ screen[i]) * 16777619u;
+
+	printf("%s core: %llu instructions in %.2fs, %.2f MIPS, screen checksum %08X\n", core_arg, executed, seconds, executed / seconds / 1000000.0, checksum);
+	vxt_close(e);
+	free(image);
+	return 0;
+}